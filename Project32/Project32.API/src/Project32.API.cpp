@@ -44,6 +44,11 @@ bool LoadEngineDLL(const std::wstring& dllPath) {
     engine.DestroyEngine = (DestroyEngineFunc)GetProcAddress(g_hDllModule, "DestroyEngine");
     engine.RunEngine = (RunEngineFunc)GetProcAddress(g_hDllModule, "RunEngine");
     engine.RunAllEngines = (RunAllEnginesFunc)GetProcAddress(g_hDllModule, "RunAllEngines");
+    engine.SetThreadedRendering = (SetThreadedRenderingFunc)GetProcAddress(g_hDllModule, "SetThreadedRendering");
+    engine.IsThreadedRendering = (IsThreadedRenderingFunc)GetProcAddress(g_hDllModule, "IsThreadedRendering");
+    engine.EnableNullBackend = (EnableNullBackendFunc)GetProcAddress(g_hDllModule, "EnableNullBackend");
+    engine.GetNullBackendStats = (GetNullBackendStatsFunc)GetProcAddress(g_hDllModule, "GetNullBackendStats");
+    engine.ResetNullBackendStats = (ResetNullBackendStatsFunc)GetProcAddress(g_hDllModule, "ResetNullBackendStats");
     engine.IsEngineRunning = (IsEngineRunningFunc)GetProcAddress(g_hDllModule, "IsEngineRunning");
     engine.GetEngineCount = (GetEngineCountFunc)GetProcAddress(g_hDllModule, "GetEngineCount");
     engine.SetCurrentEngine = (SetCurrentEngineFunc)GetProcAddress(g_hDllModule, "SetCurrentEngine");
@@ -62,6 +67,11 @@ bool LoadEngineDLL(const std::wstring& dllPath) {
     engine.SetEngineFOV = (SetEngineFOVFunc)GetProcAddress(g_hDllModule, "SetEngineFOV");
     engine.ToggleEngineWireframe = (ToggleEngineWireframeFunc)GetProcAddress(g_hDllModule, "ToggleEngineWireframe");
     engine.ToggleEngineDebugInfo = (ToggleEngineDebugInfoFunc)GetProcAddress(g_hDllModule, "ToggleEngineDebugInfo");
+    engine.SetEngineTargetFPS = (SetEngineTargetFPSFunc)GetProcAddress(g_hDllModule, "SetEngineTargetFPS");
+    engine.GetEngineTargetFPS = (GetEngineTargetFPSFunc)GetProcAddress(g_hDllModule, "GetEngineTargetFPS");
+    engine.SetEngineBackgroundFPS = (SetEngineBackgroundFPSFunc)GetProcAddress(g_hDllModule, "SetEngineBackgroundFPS");
+    engine.GetEngineFrameStats = (GetEngineFrameStatsFunc)GetProcAddress(g_hDllModule, "GetEngineFrameStats");
+    engine.GetEngineFrameStatsHistory = (GetEngineFrameStatsHistoryFunc)GetProcAddress(g_hDllModule, "GetEngineFrameStatsHistory");
     engine.ToggleEngineRenderScene = (ToggleEngineRenderSceneFunc)GetProcAddress(g_hDllModule, "ToggleEngineRenderScene");
 
     // Engine window management
@@ -208,6 +218,31 @@ namespace P32 {
         engine.RunAllEngines();
     }
 
+    void Engine::SetThreadedRendering(bool enabled) {
+        if (!isLoaded || !engine.SetThreadedRendering) return;
+        engine.SetThreadedRendering(enabled);
+    }
+
+    bool Engine::IsThreadedRendering() {
+        if (!isLoaded || !engine.IsThreadedRendering) return false;
+        return engine.IsThreadedRendering();
+    }
+
+    bool Engine::EnableNullBackend() {
+        if (!isLoaded || !engine.EnableNullBackend) return false;
+        return engine.EnableNullBackend();
+    }
+
+    bool Engine::GetNullBackendStats(P32BackendStats* stats) {
+        if (!isLoaded || !engine.GetNullBackendStats) return false;
+        return engine.GetNullBackendStats(stats);
+    }
+
+    void Engine::ResetNullBackendStats() {
+        if (!isLoaded || !engine.ResetNullBackendStats) return;
+        engine.ResetNullBackendStats();
+    }
+
     bool Engine::IsEngineRunning(int engineID) {
         if (!isLoaded || !engine.IsEngineRunning) return false;
         return engine.IsEngineRunning(engineID);
@@ -293,6 +328,31 @@ namespace P32 {
         engine.ToggleEngineDebugInfo(engineID);
     }
 
+    void Engine::SetEngineTargetFPS(int engineID, float fps) {
+        if (!isLoaded || !engine.SetEngineTargetFPS) return;
+        engine.SetEngineTargetFPS(engineID, fps);
+    }
+
+    float Engine::GetEngineTargetFPS(int engineID) {
+        if (!isLoaded || !engine.GetEngineTargetFPS) return 0.0f;
+        return engine.GetEngineTargetFPS(engineID);
+    }
+
+    void Engine::SetEngineBackgroundFPS(int engineID, float fps) {
+        if (!isLoaded || !engine.SetEngineBackgroundFPS) return;
+        engine.SetEngineBackgroundFPS(engineID, fps);
+    }
+
+    bool Engine::GetEngineFrameStats(int engineID, P32FrameStats* stats) {
+        if (!isLoaded || !engine.GetEngineFrameStats) return false;
+        return engine.GetEngineFrameStats(engineID, stats);
+    }
+
+    int Engine::GetEngineFrameStatsHistory(int engineID, P32FrameStats* stats, int maxCount) {
+        if (!isLoaded || !engine.GetEngineFrameStatsHistory) return 0;
+        return engine.GetEngineFrameStatsHistory(engineID, stats, maxCount);
+    }
+
     // Engine window management
     bool Engine::SetEngineWindowSize(int engineID, int width, int height) {
         if (!isLoaded || !engine.SetEngineWindowSize) return false;
@@ -606,6 +666,38 @@ namespace P32 {
         }
     }
 
+    void EngineInstance::SetTargetFPS(float fps) {
+        if (_valid) {
+            Engine::SetEngineTargetFPS(_engineID, fps);
+        }
+    }
+
+    float EngineInstance::GetTargetFPS() const {
+        if (!_valid) return 0.0f;
+        return Engine::GetEngineTargetFPS(_engineID);
+    }
+
+    void EngineInstance::SetBackgroundFPS(float fps) {
+        if (_valid) {
+            Engine::SetEngineBackgroundFPS(_engineID, fps);
+        }
+    }
+
+    bool EngineInstance::GetFrameStats(P32FrameStats* stats) const {
+        if (!_valid) return false;
+        return Engine::GetEngineFrameStats(_engineID, stats);
+    }
+
+    std::vector<P32FrameStats> EngineInstance::GetFrameStatsHistory(int maxCount) const {
+        std::vector<P32FrameStats> history;
+        if (!_valid || maxCount <= 0) return history;
+
+        history.resize(static_cast<size_t>(maxCount));
+        int count = Engine::GetEngineFrameStatsHistory(_engineID, history.data(), maxCount);
+        history.resize(static_cast<size_t>(std::max(count, 0)));
+        return history;
+    }
+
     void EngineInstance::ToggleDebugInfo() {
         if (_valid) {
             Engine::ToggleEngineDebugInfo(_engineID);
@@ -48,6 +48,25 @@ extern "C" {
     typedef bool (*DestroyEngineFunc)(int engineID);
     typedef void (*RunEngineFunc)(int engineID);
     typedef void (*RunAllEnginesFunc)();
+    typedef void (*SetThreadedRenderingFunc)(bool enabled);
+    typedef bool (*IsThreadedRenderingFunc)();
+
+    // Headless backend, same layout as NullBackendStats in the engine
+    struct P32BackendStats {
+        unsigned long long frames;
+        unsigned long long drawCalls;
+        unsigned long long triangles;
+        unsigned long long stateChanges;
+        unsigned long long shaderBinds;
+        unsigned long long uniformUploads;
+        unsigned long long bufferUploads;
+        unsigned long long bytesUploaded;
+        unsigned long long skippedStateChanges;
+    };
+    typedef bool (*EnableNullBackendFunc)();
+    typedef bool (*GetNullBackendStatsFunc)(P32BackendStats* stats);
+    typedef void (*ResetNullBackendStatsFunc)();
+
     typedef bool (*IsEngineRunningFunc)(int engineID);
     typedef int (*GetEngineCountFunc)();
     typedef void (*SetCurrentEngineFunc)(int engineID);
@@ -67,6 +86,35 @@ extern "C" {
     typedef void (*ToggleEngineRenderSceneFunc)(int engineID);
     typedef void (*ToggleEngineWireframeFunc)(int engineID);
     typedef void (*ToggleEngineDebugInfoFunc)(int engineID);
+    typedef void (*SetEngineTargetFPSFunc)(int engineID, float fps);
+    typedef float (*GetEngineTargetFPSFunc)(int engineID);
+    typedef void (*SetEngineBackgroundFPSFunc)(int engineID, float fps);
+
+	// Engine telemetry, same layout as FrameStats in the engine
+    struct P32FrameStats {
+        unsigned long long frameIndex;
+        unsigned long long drawCalls;
+        unsigned long long triangles;
+        unsigned long long uniformUploads;
+        unsigned long long bufferUploads;
+        unsigned long long bytesUploaded;
+        unsigned long long stateCallsIssued;
+        unsigned long long stateCallsSkipped;
+        float frameMs;
+        float renderMs;
+        float updateMs;
+        float scriptMs;
+        unsigned int visibleObjects;
+        unsigned int culledObjects;
+        unsigned int visibleShadowCasters;
+        unsigned int culledShadowCasters;
+        unsigned int shadowLayersRebuilt;
+        unsigned int shadowLayersCached;
+        unsigned int occludedObjects;
+        unsigned int occluders;
+    };
+    typedef bool (*GetEngineFrameStatsFunc)(int engineID, P32FrameStats* stats);
+    typedef int (*GetEngineFrameStatsHistoryFunc)(int engineID, P32FrameStats* stats, int maxCount);
 
 	// Engine window management
     typedef bool (*SetEngineWindowSizeFunc)(int engineID, int width, int height);
@@ -110,6 +158,11 @@ extern "C" {
         DestroyEngineFunc DestroyEngine;
         RunEngineFunc RunEngine;
         RunAllEnginesFunc RunAllEngines;
+        SetThreadedRenderingFunc SetThreadedRendering;
+        IsThreadedRenderingFunc IsThreadedRendering;
+        EnableNullBackendFunc EnableNullBackend;
+        GetNullBackendStatsFunc GetNullBackendStats;
+        ResetNullBackendStatsFunc ResetNullBackendStats;
         IsEngineRunningFunc IsEngineRunning;
         GetEngineCountFunc GetEngineCount;
         SetCurrentEngineFunc SetCurrentEngine;
@@ -129,6 +182,13 @@ extern "C" {
         ToggleEngineRenderSceneFunc ToggleEngineRenderScene;
         ToggleEngineWireframeFunc ToggleEngineWireframe;
         ToggleEngineDebugInfoFunc ToggleEngineDebugInfo;
+        SetEngineTargetFPSFunc SetEngineTargetFPS;
+        GetEngineTargetFPSFunc GetEngineTargetFPS;
+        SetEngineBackgroundFPSFunc SetEngineBackgroundFPS;
+
+		// Engine telemetry
+        GetEngineFrameStatsFunc GetEngineFrameStats;
+        GetEngineFrameStatsHistoryFunc GetEngineFrameStatsHistory;
 
 		// Engine window management
         SetEngineWindowSizeFunc SetEngineWindowSize;
@@ -212,6 +272,13 @@ namespace P32 {
         static bool DestroyEngine(int engineID);
         static void RunEngine(int engineID);
         static void RunAllEngines();
+        static void SetThreadedRendering(bool enabled);
+        static bool IsThreadedRendering();
+
+        // Call before creating any engine, windows are then headless
+        static bool EnableNullBackend();
+        static bool GetNullBackendStats(P32BackendStats* stats);
+        static void ResetNullBackendStats();
         static bool IsEngineRunning(int engineID);
         static int GetEngineCount();
         static void SetCurrentEngine(int engineID);
@@ -231,6 +298,13 @@ namespace P32 {
         static void ToggleEngineRenderScene(int engineID);
         static void ToggleEngineWireframe(int engineID);
         static void ToggleEngineDebugInfo(int engineID);
+        static void SetEngineTargetFPS(int engineID, float fps);
+        static float GetEngineTargetFPS(int engineID);
+        static void SetEngineBackgroundFPS(int engineID, float fps);
+
+		// Engine telemetry
+        static bool GetEngineFrameStats(int engineID, P32FrameStats* stats);
+        static int GetEngineFrameStatsHistory(int engineID, P32FrameStats* stats, int maxCount);
 
 		// Engine window management
         static bool SetEngineWindowSize(int engineID, int width, int height);
@@ -323,6 +397,11 @@ namespace P32 {
         void SetFOV(float fov);
         void ToggleWireframe();
         void ToggleDebugInfo();
+        void SetTargetFPS(float fps);
+        float GetTargetFPS() const;
+        void SetBackgroundFPS(float fps);
+        bool GetFrameStats(P32FrameStats* stats) const;
+        std::vector<P32FrameStats> GetFrameStatsHistory(int maxCount = 256) const;
         bool SetWindowSize(int width, int height);
         void GetWindowSize(int* width, int* height) const;
         void SetWindowTitle(const std::string& title);
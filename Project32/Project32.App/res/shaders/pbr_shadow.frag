@@ -1,62 +1,110 @@
-#version 330 core
+#version 420 core
 out vec4 FragColor;
 
 in VS_OUT {
     vec3 FragPos;
     vec2 TexCoord;
     vec3 Color;
-    vec4 FragPosLightSpace;
+    float ViewDepth;
     mat3 TBN;
     vec3 Normal;
+    vec3 Material;
 } fs_in;
 
-// Material properties
-uniform vec3 albedo;
-uniform float metallic;
-uniform float roughness;
-uniform float ao;
-
-// Textures
-uniform sampler2D albedoMap;
-uniform sampler2D normalMap;
-uniform sampler2D metallicMap;
-uniform sampler2D roughnessMap;
-uniform sampler2D aoMap;
-uniform sampler2D shadowMap;
-
-// Texture flags
-uniform bool useAlbedoMap;
-uniform bool useNormalMap;
-uniform bool useMetallicMap;
-uniform bool useRoughnessMap;
-uniform bool useAOMap;
-
-// Simple lighting (backward compatible)
-uniform vec3 lightPos;
-uniform vec3 viewPos;
-uniform vec3 color;
+#define MAX_CASCADES 4
+
+layout (std140, binding = 0) uniform FrameBlock {
+    mat4 cascadeMatrices[MAX_CASCADES];
+    vec4 cascadeSplits;     // view space far distance of each cascade
+    ivec4 shadowInfo;       // x cascade count
+    vec4 frameTime;         // seconds, delta, frame index
+};
+
+layout (std140, binding = 1) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+};
+
+#define MAX_LIGHTS 8
+#define LIGHT_DIRECTIONAL 0
+#define LIGHT_POINT 1
+#define LIGHT_SPOT 2
+
+struct Light {
+    vec4 positionRange;     // xyz position, w range
+    vec4 colorType;         // rgb radiance, w type
+    vec4 directionShadow;   // xyz direction, w casts shadows
+    vec4 spotCutoff;        // x inner cos, y outer cos
+};
+
+// Directional lights, or every light when clustering is off
+layout (std140, binding = 2) uniform LightBlock {
+    Light lights[MAX_LIGHTS];
+    ivec4 lightCount;
+};
+
+// Point and spot lights are looked up through a froxel grid, see LightClusterGrid
+layout (std140, binding = 4) uniform ClusterBlock {
+    uvec4 clusterGrid;      // xyz cluster counts, w clustered light count
+    vec4 clusterDepth;      // near, far, slice scale, slice bias
+    vec4 clusterTile;       // tile size in pixels
+};
+
+// Metallic/roughness/ao come per instance unless a map is enabled
+layout (std140, binding = 3) uniform MaterialBlock {
+    vec4 albedo;
+    vec4 materialParams;    // metallic, roughness, ao
+    ivec4 materialMaps;     // albedo, normal, metallic, roughness
+    ivec4 materialExtraMaps; // ao
+};
+
+// Texture units match TextureUnit in uniform_blocks.h
+layout (binding = 0) uniform sampler2D albedoMap;
+layout (binding = 1) uniform sampler2DArray shadowMap;
+layout (binding = 2) uniform sampler2D normalMap;
+layout (binding = 3) uniform sampler2D metallicMap;
+layout (binding = 4) uniform sampler2D roughnessMap;
+layout (binding = 5) uniform sampler2D aoMap;
+layout (binding = 6) uniform samplerBuffer clusterLights;    // four texels per light
+layout (binding = 7) uniform usamplerBuffer clusterRanges;   // offset, count per cluster
+layout (binding = 8) uniform usamplerBuffer clusterIndices;
 
 const float PI = 3.14159265359;
 
+// First cascade whose far split lies beyond the fragment, -1 past the last one
+int SelectCascade(float viewDepth) {
+    for (int i = 0; i < shadowInfo.x; ++i) {
+        if (viewDepth <= cascadeSplits[i])
+            return i;
+    }
+    return -1;
+}
+
 // Shadow calculation
-float ShadowCalculation(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir) {
+float ShadowCalculation(vec3 fragPos, float viewDepth, vec3 normal, vec3 lightDir) {
+    int cascade = SelectCascade(viewDepth);
+    if (cascade < 0)
+        return 0.0;
+
+    vec4 fragPosLightSpace = cascadeMatrices[cascade] * vec4(fragPos, 1.0);
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
     projCoords = projCoords * 0.5 + 0.5;
     
     if(projCoords.z > 1.0)
         return 0.0;
     
-    float closestDepth = texture(shadowMap, projCoords.xy).r;
     float currentDepth = projCoords.z;
     
     float bias = max(0.05 * (1.0 - dot(normal, lightDir)), 0.005);
     
     // PCF
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(shadowMap, 0);
+    vec2 texelSize = 1.0 / vec2(textureSize(shadowMap, 0).xy);
     for(int x = -1; x <= 1; ++x) {
         for(int y = -1; y <= 1; ++y) {
-            float pcfDepth = texture(shadowMap, projCoords.xy + vec2(x, y) * texelSize).r;
+            float pcfDepth = texture(shadowMap, vec3(projCoords.xy + vec2(x, y) * texelSize, float(cascade))).r;
             shadow += currentDepth - bias > pcfDepth ? 1.0 : 0.0;
         }
     }
@@ -65,6 +113,50 @@ float ShadowCalculation(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir) {
     return shadow;
 }
 
+// Direction towards the light (L) and the radiance it delivers at fragPos
+vec3 LightRadiance(Light light, vec3 fragPos, out vec3 L) {
+    int type = int(light.colorType.w);
+    if (type == LIGHT_DIRECTIONAL) {
+        L = normalize(-light.directionShadow.xyz);
+        return light.colorType.rgb;
+    }
+
+    vec3 toLight = light.positionRange.xyz - fragPos;
+    float distance = length(toLight);
+    L = toLight / max(distance, 0.0001);
+
+    // Inverse square, faded to zero at the light range
+    float falloff = clamp(1.0 - pow(distance / max(light.positionRange.w, 0.0001), 4.0), 0.0, 1.0);
+    float attenuation = falloff * falloff / (distance * distance + 1.0);
+
+    if (type == LIGHT_SPOT) {
+        float theta = dot(L, normalize(-light.directionShadow.xyz));
+        float epsilon = max(light.spotCutoff.x - light.spotCutoff.y, 0.0001);
+        attenuation *= clamp((theta - light.spotCutoff.y) / epsilon, 0.0, 1.0);
+    }
+
+    return light.colorType.rgb * attenuation;
+}
+
+Light FetchClusterLight(int index) {
+    Light light;
+    light.positionRange = texelFetch(clusterLights, index * 4);
+    light.colorType = texelFetch(clusterLights, index * 4 + 1);
+    light.directionShadow = texelFetch(clusterLights, index * 4 + 2);
+    light.spotCutoff = texelFetch(clusterLights, index * 4 + 3);
+    return light;
+}
+
+// Offset and count of the cluster the fragment falls into
+uvec2 FindCluster(float viewDepth) {
+    uvec3 grid = clusterGrid.xyz;
+    uvec2 tile = min(uvec2(gl_FragCoord.xy / clusterTile.xy), grid.xy - 1u);
+    float slice = log(max(viewDepth, clusterDepth.x)) * clusterDepth.z - clusterDepth.w;
+    uint z = min(uint(max(slice, 0.0)), grid.z - 1u);
+    int cluster = int(tile.x + grid.x * (tile.y + grid.y * z));
+    return texelFetch(clusterRanges, cluster).xy;
+}
+
 // Normal Distribution Function
 float DistributionGGX(vec3 N, vec3 H, float roughness) {
     float a = roughness * roughness;
@@ -104,75 +196,97 @@ vec3 fresnelSchlick(float cosTheta, vec3 F0) {
     return F0 + (1.0 - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
+// Cook-Torrance BRDF times NdotL, radiance not applied
+vec3 ShadeLight(vec3 N, vec3 V, vec3 L, vec3 F0, vec3 albedoValue, float metallicValue, float roughnessValue) {
+    vec3 H = normalize(V + L);
+
+    float NDF = DistributionGGX(N, H, roughnessValue);
+    float G = GeometrySmith(N, V, L, roughnessValue);
+    vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+
+    vec3 kS = F;
+    vec3 kD = vec3(1.0) - kS;
+    kD *= 1.0 - metallicValue;
+
+    vec3 numerator = NDF * G * F;
+    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;
+    vec3 specular = numerator / denominator;
+
+    float NdotL = max(dot(N, L), 0.0);
+    return (kD * albedoValue / PI + specular) * NdotL;
+}
+
 void main() {
     // Sample material properties
-    vec3 albedoValue = useAlbedoMap ? 
-        pow(texture(albedoMap, fs_in.TexCoord).rgb, vec3(2.2)) : 
-        albedo * color * fs_in.Color;
-    
-    float metallicValue = useMetallicMap ? 
-        texture(metallicMap, fs_in.TexCoord).r : 
-        metallic;
-    
-    float roughnessValue = useRoughnessMap ? 
-        texture(roughnessMap, fs_in.TexCoord).r : 
-        roughness;
-    
-    float aoValue = useAOMap ? 
-        texture(aoMap, fs_in.TexCoord).r : 
-        ao;
-    
+    vec3 albedoValue = materialMaps.x != 0 ?
+        pow(texture(albedoMap, fs_in.TexCoord).rgb, vec3(2.2)) :
+        albedo.rgb * fs_in.Color;
+
+    float metallicValue = materialMaps.z != 0 ?
+        texture(metallicMap, fs_in.TexCoord).r :
+        fs_in.Material.x;
+
+    float roughnessValue = materialMaps.w != 0 ?
+        texture(roughnessMap, fs_in.TexCoord).r :
+        fs_in.Material.y;
+
+    float aoValue = materialExtraMaps.x != 0 ?
+        texture(aoMap, fs_in.TexCoord).r :
+        fs_in.Material.z;
+
     // Sample normal map and transform to world space
     vec3 N;
-    if(useNormalMap) {
+    if(materialMaps.y != 0) {
         N = texture(normalMap, fs_in.TexCoord).rgb;
         N = N * 2.0 - 1.0;
         N = normalize(fs_in.TBN * N);
     } else {
         N = normalize(fs_in.Normal);
     }
-    
-    vec3 V = normalize(viewPos - fs_in.FragPos);
-    
+
+    vec3 V = normalize(cameraPosition.xyz - fs_in.FragPos);
+
     // Calculate reflectance at normal incidence
     vec3 F0 = vec3(0.04);
     F0 = mix(F0, albedoValue, metallicValue);
-    
-    // Single light calculation
-    vec3 L = normalize(lightPos - fs_in.FragPos);
-    vec3 H = normalize(V + L);
-    float distance = length(lightPos - fs_in.FragPos);
-    float attenuation = 1.0 / (distance * distance);
-    vec3 radiance = vec3(3.0) * attenuation; // White light with intensity 3.0
-    
-    // Cook-Torrance BRDF
-    float NDF = DistributionGGX(N, H, roughnessValue);
-    float G = GeometrySmith(N, V, L, roughnessValue);
-    vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
-    
-    vec3 kS = F;
-    vec3 kD = vec3(1.0) - kS;
-    kD *= 1.0 - metallicValue;
-    
-    vec3 numerator = NDF * G * F;
-    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;
-    vec3 specular = numerator / denominator;
-    
-    float NdotL = max(dot(N, L), 0.0);
-    
-    // Shadow calculation
-    float shadow = ShadowCalculation(fs_in.FragPosLightSpace, N, L);
-    
-    vec3 Lo = (kD * albedoValue / PI + specular) * radiance * NdotL * (1.0 - shadow);
-    
+
+    // The shadow map belongs to the first shadow casting light
+    bool shadowUsed = false;
+    vec3 Lo = vec3(0.0);
+
+    for (int i = 0; i < lightCount.x; ++i) {
+        vec3 L;
+        vec3 radiance = LightRadiance(lights[i], fs_in.FragPos, L);
+        vec3 contribution = ShadeLight(N, V, L, F0, albedoValue, metallicValue, roughnessValue) * radiance;
+
+        float shadow = 0.0;
+        if (!shadowUsed && lights[i].directionShadow.w > 0.5) {
+            shadow = ShadowCalculation(fs_in.FragPos, fs_in.ViewDepth, N, L);
+            shadowUsed = true;
+        }
+
+        Lo += contribution * (1.0 - shadow);
+    }
+
+    // Only the lights whose range reaches this cluster
+    if (clusterGrid.w > 0u) {
+        uvec2 cluster = FindCluster(fs_in.ViewDepth);
+        for (uint i = 0u; i < cluster.y; ++i) {
+            int index = int(texelFetch(clusterIndices, int(cluster.x + i)).r);
+            vec3 L;
+            vec3 radiance = LightRadiance(FetchClusterLight(index), fs_in.FragPos, L);
+            Lo += ShadeLight(N, V, L, F0, albedoValue, metallicValue, roughnessValue) * radiance;
+        }
+    }
+
     // Ambient lighting
     vec3 ambient = vec3(0.03) * albedoValue * aoValue;
     vec3 finalColor = ambient + Lo;
-    
+
     // HDR tonemapping
     finalColor = finalColor / (finalColor + vec3(1.0));
     // Gamma correction
     finalColor = pow(finalColor, vec3(1.0/2.2));
-    
+
     FragColor = vec4(finalColor, 1.0);
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-#version 330 core
+#version 420 core
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoord;
@@ -6,25 +6,45 @@ layout (location = 3) in vec3 aColor;
 layout (location = 4) in vec3 aTangent;
 layout (location = 5) in vec3 aBitangent;
 
+// Per instance (InstanceData)
+layout (location = 6) in mat4 aInstanceModel;
+layout (location = 10) in vec4 aInstanceColor;
+layout (location = 11) in vec4 aInstanceMaterial;
+
 out VS_OUT {
     vec3 FragPos;
     vec2 TexCoord;
     vec3 Color;
-    vec4 FragPosLightSpace;
+    float ViewDepth;
     mat3 TBN;
     vec3 Normal;
+    vec3 Material;
 } vs_out;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
-uniform mat4 lightSpaceMatrix;
+#define MAX_CASCADES 4
+
+layout (std140, binding = 0) uniform FrameBlock {
+    mat4 cascadeMatrices[MAX_CASCADES];
+    vec4 cascadeSplits;     // view space far distance of each cascade
+    ivec4 shadowInfo;       // x cascade count
+    vec4 frameTime;         // seconds, delta, frame index
+};
+
+layout (std140, binding = 1) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+};
 
 void main() {
+    mat4 model = aInstanceModel;
+
     vs_out.FragPos = vec3(model * vec4(aPos, 1.0));
     vs_out.TexCoord = aTexCoord;
-    vs_out.Color = aColor;
-    vs_out.FragPosLightSpace = lightSpaceMatrix * vec4(vs_out.FragPos, 1.0);
+    vs_out.Color = aColor * aInstanceColor.rgb;
+    vs_out.Material = aInstanceMaterial.xyz;
+    vs_out.ViewDepth = -(view * vec4(vs_out.FragPos, 1.0)).z;
     
     // Calculate TBN matrix for normal mapping
     mat3 normalMatrix = transpose(inverse(mat3(model)));
@@ -37,5 +57,5 @@ void main() {
     vs_out.TBN = mat3(T, B, N);
     vs_out.Normal = N;
     
-    gl_Position = projection * view * vec4(vs_out.FragPos, 1.0);
+    gl_Position = viewProjection * vec4(vs_out.FragPos, 1.0);
 }
\ No newline at end of file
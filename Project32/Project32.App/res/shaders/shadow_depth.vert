@@ -1,10 +1,22 @@
-#version 330 core
+#version 420 core
 
 layout (location = 0) in vec3 aPos;
+layout (location = 6) in mat4 aInstanceModel;
 
-uniform mat4 lightSpaceMatrix;
-uniform mat4 model;
+#define MAX_CASCADES 4
+
+layout (std140, binding = 0) uniform FrameBlock {
+    mat4 cascadeMatrices[MAX_CASCADES];
+    vec4 cascadeSplits;     // view space far distance of each cascade
+    ivec4 shadowInfo;       // x cascade count
+    vec4 frameTime;         // seconds, delta, frame index
+};
+
+// Layer of the shadow map array being rendered
+layout (std140, binding = 5) uniform ShadowLayerBlock {
+    ivec4 shadowLayer;      // x cascade index
+};
 
 void main() {
-    gl_Position = lightSpaceMatrix * model * vec4(aPos, 1.0);
+    gl_Position = cascadeMatrices[shadowLayer.x] * aInstanceModel * vec4(aPos, 1.0);
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-#version 330 core
+#version 420 core
 
 out vec4 FragColor;
 
@@ -6,19 +6,66 @@ in vec3 FragPos;
 in vec3 Normal;
 in vec2 TexCoords;
 
-uniform vec3 color;
-uniform vec3 lightPos;
-uniform vec3 viewPos;
-uniform bool useTexture;
-uniform sampler2D uTexture;
+layout (std140, binding = 1) uniform CameraBlock {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+};
 
-// PBR material properties
-uniform float metallic;   // 0.0 = dielectric, 1.0 = metal
-uniform float roughness;   // 0.0 = smooth, 1.0 = rough
-uniform float ao;          // ambient occlusion (0.0 to 1.0)
+#define MAX_LIGHTS 8
+#define LIGHT_DIRECTIONAL 0
+#define LIGHT_POINT 1
+#define LIGHT_SPOT 2
+
+struct Light {
+    vec4 positionRange;     // xyz position, w range
+    vec4 colorType;         // rgb radiance, w type
+    vec4 directionShadow;   // xyz direction, w casts shadows
+    vec4 spotCutoff;        // x inner cos, y outer cos
+};
+
+layout (std140, binding = 2) uniform LightBlock {
+    Light lights[MAX_LIGHTS];
+    ivec4 lightCount;
+};
+
+layout (std140, binding = 3) uniform MaterialBlock {
+    vec4 albedo;
+    vec4 materialParams;    // metallic, roughness, ao
+    ivec4 materialMaps;     // albedo, normal, metallic, roughness
+    ivec4 materialExtraMaps; // ao
+};
+
+layout (binding = 0) uniform sampler2D uTexture;
 
 const float PI = 3.14159265359;
 
+// Direction towards the light (L) and the radiance it delivers at fragPos
+vec3 LightRadiance(Light light, vec3 fragPos, out vec3 L) {
+    int type = int(light.colorType.w);
+    if (type == LIGHT_DIRECTIONAL) {
+        L = normalize(-light.directionShadow.xyz);
+        return light.colorType.rgb;
+    }
+
+    vec3 toLight = light.positionRange.xyz - fragPos;
+    float distance = length(toLight);
+    L = toLight / max(distance, 0.0001);
+
+    // Inverse square, faded to zero at the light range
+    float falloff = clamp(1.0 - pow(distance / max(light.positionRange.w, 0.0001), 4.0), 0.0, 1.0);
+    float attenuation = falloff * falloff / (distance * distance + 1.0);
+
+    if (type == LIGHT_SPOT) {
+        float theta = dot(L, normalize(-light.directionShadow.xyz));
+        float epsilon = max(light.spotCutoff.x - light.spotCutoff.y, 0.0001);
+        attenuation *= clamp((theta - light.spotCutoff.y) / epsilon, 0.0, 1.0);
+    }
+
+    return light.colorType.rgb * attenuation;
+}
+
 // Normal Distribution Function (GGX/Trowbridge-Reitz)
 float DistributionGGX(vec3 N, vec3 H, float roughness) {
     float a = roughness * roughness;
@@ -57,51 +104,55 @@ vec3 fresnelSchlick(float cosTheta, vec3 F0) {
 }
 
 void main() {
+    float metallic = materialParams.x;   // 0.0 = dielectric, 1.0 = metal
+    float roughness = materialParams.y;  // 0.0 = smooth, 1.0 = rough
+    float ao = materialParams.z;         // ambient occlusion (0.0 to 1.0)
+
     // Get material color
-    vec3 albedo;
-    if (useTexture) {
-        albedo = pow(texture(uTexture, TexCoords).rgb, vec3(2.2)) * color; // gamma correction
+    vec3 albedoColor;
+    if (materialMaps.x != 0) {
+        albedoColor = pow(texture(uTexture, TexCoords).rgb, vec3(2.2)) * albedo.rgb; // gamma correction
     } else {
-        albedo = color;
+        albedoColor = albedo.rgb;
     }
     
     vec3 N = normalize(Normal);
-    vec3 V = normalize(viewPos - FragPos);
+    vec3 V = normalize(cameraPosition.xyz - FragPos);
     
     // Calculate reflectance at normal incidence
     // For dielectrics use 0.04, for metals use the albedo color
     vec3 F0 = vec3(0.04);
-    F0 = mix(F0, albedo, metallic);
+    F0 = mix(F0, albedoColor, metallic);
     
     // Reflectance equation
     vec3 Lo = vec3(0.0);
     
-    // Calculate per-light radiance
-    vec3 L = normalize(lightPos - FragPos);
-    vec3 H = normalize(V + L);
-    float distance = length(lightPos - FragPos);
-    float attenuation = 1.0 / (distance * distance);
-    vec3 radiance = vec3(1.0) * attenuation * 300.0; // light intensity
-    
-    // Cook-Torrance BRDF
-    float NDF = DistributionGGX(N, H, roughness);
-    float G = GeometrySmith(N, V, L, roughness);
-    vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
-    
-    vec3 numerator = NDF * G * F;
-    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;
-    vec3 specular = numerator / denominator;
-    
-    // Energy conservation
-    vec3 kS = F;
-    vec3 kD = vec3(1.0) - kS;
-    kD *= 1.0 - metallic; // metals don't have diffuse
-    
-    float NdotL = max(dot(N, L), 0.0);
-    Lo += (kD * albedo / PI + specular) * radiance * NdotL;
+    for (int i = 0; i < lightCount.x; ++i) {
+        // Calculate per-light radiance
+        vec3 L;
+        vec3 radiance = LightRadiance(lights[i], FragPos, L);
+        vec3 H = normalize(V + L);
+        
+        // Cook-Torrance BRDF
+        float NDF = DistributionGGX(N, H, roughness);
+        float G = GeometrySmith(N, V, L, roughness);
+        vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+        
+        vec3 numerator = NDF * G * F;
+        float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;
+        vec3 specular = numerator / denominator;
+        
+        // Energy conservation
+        vec3 kS = F;
+        vec3 kD = vec3(1.0) - kS;
+        kD *= 1.0 - metallic; // metals don't have diffuse
+        
+        float NdotL = max(dot(N, L), 0.0);
+        Lo += (kD * albedoColor / PI + specular) * radiance * NdotL;
+    }
     
     // Ambient lighting (IBL approximation)
-    vec3 ambient = vec3(0.03) * albedo * ao;
+    vec3 ambient = vec3(0.03) * albedoColor * ao;
     
     vec3 result = ambient + Lo;
     
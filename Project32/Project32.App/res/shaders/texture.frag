@@ -1,9 +1,9 @@
-#version 330 core
+#version 420 core
 out vec4 FragColor;
 
 in vec2 TexCoord;
 
-uniform sampler2D uTexture;
+layout (binding = 0) uniform sampler2D uTexture;
 
 void main()
 {
@@ -2,14 +2,20 @@
 
 Script = {
     position = Vec3.new(0.0, 0.0, 0.0),
-    size = Vec3.new(20.0, 0.1, 20.0),
+    scale = Vec3.new(20.0, 0.1, 20.0),
     color = Vec3.new(0.3, 0.3, 0.3),
     isStatic = true
 }
 
 function Script:Init(objectID)
-    Log("Floor initialized: " .. self.size.x .. "x" .. self.size.z)
+    Log("Floor initialized: " .. self.scale.x .. "x" .. self.scale.z)
     self.objectID = objectID
+
+    -- Static, so the proxy is written once
+    RenderProxy.Create(objectID, "cube")
+    RenderProxy.SetTransform(objectID, self.position, Vec3.new(0.0, 0.0, 0.0), self.scale)
+    RenderProxy.SetColor(objectID, self.color)
+    RenderProxy.SetStatic(objectID, self.isStatic)
 end
 
 function Script:Update(objectID, dt)
@@ -19,5 +25,6 @@ function Script:FixedUpdate(objectID, fixedDt)
 end
 
 function Script:OnDestroy(objectID)
+    RenderProxy.Destroy(objectID)
     Log("Floor destroyed")
 end
\ No newline at end of file
@@ -20,11 +20,7 @@ Script = {
 	
     -- State
     isGrounded = true,
-    isSprinting = false,
-    
-    cameraPosition = Vec3.new(0.0, 1.7, 5.0),
-    cameraRotation = Vec3.new(0.0, 0.0, 0.0),
-    isCamera = true  
+    isSprinting = false
 }
 
 function Script:Init(objectID)
@@ -57,14 +53,13 @@ function Script:Update(objectID, dt)
         self.isGrounded = false
     end
     
-    self.cameraPosition = self.position
-    self.cameraRotation = self.rotation
-    
     if self.rotation.x > 89.0 then
         self.rotation.x = 89.0
     elseif self.rotation.x < -89.0 then
         self.rotation.x = -89.0
     end
+
+    RenderProxy.SetCamera(self.position, self.rotation)
 end
 
 function Script:UpdateMouseLook(dt)
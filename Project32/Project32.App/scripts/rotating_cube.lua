@@ -2,7 +2,7 @@
 
 Script = {
     position = Vec3.new(0.0, 2.0, 0.0),
-    size = Vec3.new(1.0, 1.0, 1.0),
+    scale = Vec3.new(1.0, 1.0, 1.0),
     rotation = Vec3.new(0.0, 0.0, 0.0),
     rotationSpeed = 10.0, 
     color = Vec3.new(1.0, 0.5, 0.2),
@@ -13,31 +13,40 @@ Script = {
 function Script:Init(objectID)
     Log("Rotating Cube initialized at center")
     self.objectID = objectID
+
+    RenderProxy.Create(objectID, "cube")
+    RenderProxy.SetTransform(objectID, self.position, self.rotation, self.scale)
+    RenderProxy.SetColor(objectID, self.color)
+    RenderProxy.SetInterpolate(objectID, true)
 end
 
 function Script:Update(objectID, dt)
-    self.time = self.time + dt
+    local brightness = 0.5 + (Math.Sin(self.time * 3.0) * 0.25)
+    self.color = Vec3.new(1.0, 0.5 * brightness, 0.2)
+    RenderProxy.SetColor(objectID, self.color)
+end
+
+-- Motion runs on the fixed step and is interpolated for rendering
+function Script:FixedUpdate(objectID, fixedDt)
+    self.time = self.time + fixedDt
     
-    self.rotation.y = self.rotation.y + (self.rotationSpeed * dt)
+    self.rotation.y = self.rotation.y + (self.rotationSpeed * fixedDt)
     if self.rotation.y > 360.0 then
         self.rotation.y = self.rotation.y - 360.0
     end
     
-    self.rotation.x = self.rotation.x + (self.rotationSpeed * 0.5 * dt)
+    self.rotation.x = self.rotation.x + (self.rotationSpeed * 0.5 * fixedDt)
     if self.rotation.x > 360.0 then
         self.rotation.x = self.rotation.x - 360.0
     end
     
     local pulse = Math.Sin(self.time * self.pulseSpeed) * 0.2
     self.position.y = 1.5 + pulse
-    
-    local brightness = 0.5 + (Math.Sin(self.time * 3.0) * 0.25)
-    self.color = Vec3.new(1.0, 0.5 * brightness, 0.2)
-end
 
-function Script:FixedUpdate(objectID, fixedDt)
+    RenderProxy.SetTransform(objectID, self.position, self.rotation, self.scale)
 end
 
 function Script:OnDestroy(objectID)
+    RenderProxy.Destroy(objectID)
     Log("Rotating Cube destroyed")
 end
\ No newline at end of file
@@ -0,0 +1,258 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../common.h"
+#include "Null_backEnd.h"
+#include "../../core/telemetry.h"
+#include "../OpenGL/GL_state_cache.h"
+
+NullBackend::~NullBackend() {
+    Shutdown();
+}
+
+bool NullBackend::Init() {
+    if (m_initialized) {
+        return true;
+    }
+
+    spdlog::info("Null Backend initialized, nothing will be drawn");
+
+    m_initialized = true;
+    return true;
+}
+
+void NullBackend::Shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    NullBackendStats stats = GetStats();
+    spdlog::info("Null Backend shut down after {} frames: {} draws, {} triangles, {} state changes ({} skipped), {} uniform uploads, {} buffer uploads ({} KB)",
+        stats.frames, stats.drawCalls, stats.triangles, stats.stateChanges, stats.skippedStateChanges,
+        stats.uniformUploads, stats.bufferUploads, stats.bytesUploaded / 1024);
+
+    m_initialized = false;
+}
+
+// State goes through the same cache as GL, so headless runs see how many
+// calls it would have dropped
+void NullBackend::BeginFrame() {
+    Count(m_frames);
+    GLStateCache& state = GLStateCache::GetCurrent();
+    CountState(state.SetEnabled(GL_DEPTH_TEST, true));
+    CountState(state.DepthFunc(GL_LESS));
+}
+
+void NullBackend::EndFrame() {
+    GLStateCounters counters = GLStateCache::GetCurrent().TakeFrameCounters();
+    Telemetry::CountStateCalls(counters.issued, counters.skipped);
+}
+
+void NullBackend::Clear(const glm::vec4& color) {
+    Count(m_stateChanges);
+}
+
+void NullBackend::SetViewport(int x, int y, int width, int height) {
+    CountState(GLStateCache::GetCurrent().Viewport(x, y, width, height));
+}
+
+ShadowMap* NullBackend::CreateShadowMap(unsigned int width, unsigned int height) {
+    ShadowMap* shadowMap = new ShadowMap(width, height);
+    if (!shadowMap->Initialize()) {
+        delete shadowMap;
+        return nullptr;
+    }
+    return shadowMap;
+}
+
+void NullBackend::SetDepthTest(bool enabled) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    CountState(state.SetEnabled(GL_DEPTH_TEST, enabled));
+    if (enabled) CountState(state.DepthFunc(GL_LESS));
+}
+
+void NullBackend::SetCullFace(bool enabled) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    CountState(state.SetEnabled(GL_CULL_FACE, enabled));
+    if (enabled) {
+        CountState(state.CullFace(GL_BACK));
+        CountState(state.FrontFace(GL_CCW));
+    }
+}
+
+void NullBackend::SetWireframe(bool enabled) {
+    CountState(GLStateCache::GetCurrent().PolygonMode(enabled ? GL_LINE : GL_FILL));
+}
+
+void NullBackend::SetBlending(bool enabled) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    CountState(state.SetEnabled(GL_BLEND, enabled));
+    if (enabled) CountState(state.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+}
+
+void NullBackend::BindShader(int shaderID) {
+    bool issued = GLStateCache::GetCurrent().UseProgram(static_cast<GLuint>(shaderID));
+    if (issued) Count(m_shaderBinds);
+    CountState(issued);
+}
+
+void NullBackend::SetShaderMat4(int shaderID, const std::string& name, const glm::mat4& value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetShaderVec3(int shaderID, const std::string& name, const glm::vec3& value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetShaderFloat(int shaderID, const std::string& name, float value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetShaderInt(int shaderID, const std::string& name, int value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetShaderBool(int shaderID, const std::string& name, bool value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetUniformMat4(int location, const glm::mat4& value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetUniformVec3(int location, const glm::vec3& value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetUniformFloat(int location, float value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::SetUniformInt(int location, int value) {
+    Count(m_uniformUploads);
+    Telemetry::CountUniformUpload();
+}
+
+void NullBackend::BindTexture(unsigned int textureID, int slot) {
+    CountState(GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(slot), GL_TEXTURE_2D, textureID));
+}
+
+void NullBackend::UnbindTexture(int slot) {
+    CountState(GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(slot), GL_TEXTURE_2D, 0));
+}
+
+void NullBackend::DrawIndexed(unsigned int vao, unsigned int indexCount) {
+    CountState(GLStateCache::GetCurrent().BindVertexArray(vao));
+    Count(m_drawCalls);
+    Count(m_triangles, indexCount / 3);
+    Telemetry::CountDrawCall(indexCount / 3);
+}
+
+void NullBackend::DrawArrays(unsigned int vao, unsigned int vertexCount) {
+    CountState(GLStateCache::GetCurrent().BindVertexArray(vao));
+    Count(m_drawCalls);
+    Count(m_triangles, vertexCount / 3);
+    Telemetry::CountDrawCall(vertexCount / 3);
+}
+
+void NullBackend::DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance) {
+    CountState(GLStateCache::GetCurrent().BindVertexArray(vao));
+    Count(m_drawCalls);
+    Count(m_triangles, static_cast<uint64_t>(indexCount / 3) * instanceCount);
+    Telemetry::CountDrawCall(static_cast<uint64_t>(indexCount / 3) * instanceCount);
+}
+
+void NullBackend::DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance) {
+    CountState(GLStateCache::GetCurrent().BindVertexArray(vao));
+    Count(m_drawCalls);
+    Count(m_triangles, static_cast<uint64_t>(vertexCount / 3) * instanceCount);
+    Telemetry::CountDrawCall(static_cast<uint64_t>(vertexCount / 3) * instanceCount);
+}
+
+void NullBackend::MultiDrawIndexedIndirect(unsigned int vao, unsigned int indirectBuffer, size_t offset, unsigned int drawCount, uint64_t triangleCount) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    CountState(state.BindVertexArray(vao));
+    CountState(state.BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer));
+    Count(m_drawCalls);
+    Count(m_triangles, triangleCount);
+    Telemetry::CountDrawCall(triangleCount);
+}
+
+unsigned int NullBackend::CreateBuffer() {
+    return AllocateHandle();
+}
+
+void NullBackend::DeleteBuffer(unsigned int bufferID) {
+
+}
+
+unsigned int NullBackend::CreateVertexArray() {
+    return AllocateHandle();
+}
+
+void NullBackend::DeleteVertexArray(unsigned int vaoID) {
+
+}
+
+void NullBackend::UploadBufferData(unsigned int bufferID, const void* data, size_t size) {
+    CountState(GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, bufferID));
+    Count(m_bufferUploads);
+    Count(m_bytesUploaded, size);
+    Telemetry::CountBufferUpload(size);
+}
+
+unsigned int NullBackend::CreateUniformBuffer(size_t size) {
+    return AllocateHandle();
+}
+
+void NullBackend::UpdateBufferSubData(unsigned int bufferID, const void* data, size_t size, size_t offset) {
+    Count(m_bufferUploads);
+    Count(m_bytesUploaded, size);
+    Telemetry::CountBufferUpload(size);
+}
+
+void NullBackend::BindUniformBuffer(unsigned int bufferID, unsigned int binding) {
+    CountState(GLStateCache::GetCurrent().BindBufferBase(GL_UNIFORM_BUFFER, binding, bufferID));
+}
+
+NullBackendStats NullBackend::GetStats() const {
+    NullBackendStats stats;
+    stats.frames = m_frames.load(std::memory_order_relaxed);
+    stats.drawCalls = m_drawCalls.load(std::memory_order_relaxed);
+    stats.triangles = m_triangles.load(std::memory_order_relaxed);
+    stats.stateChanges = m_stateChanges.load(std::memory_order_relaxed);
+    stats.shaderBinds = m_shaderBinds.load(std::memory_order_relaxed);
+    stats.uniformUploads = m_uniformUploads.load(std::memory_order_relaxed);
+    stats.bufferUploads = m_bufferUploads.load(std::memory_order_relaxed);
+    stats.bytesUploaded = m_bytesUploaded.load(std::memory_order_relaxed);
+    stats.skippedStateChanges = m_skippedStateChanges.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void NullBackend::ResetStats() {
+    m_frames.store(0);
+    m_drawCalls.store(0);
+    m_triangles.store(0);
+    m_stateChanges.store(0);
+    m_shaderBinds.store(0);
+    m_uniformUploads.store(0);
+    m_bufferUploads.store(0);
+    m_bytesUploaded.store(0);
+    m_skippedStateChanges.store(0);
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#ifndef NULL_BACKEND_H
+#define NULL_BACKEND_H
+
+#include "../../common.h"
+#include "../backend.h"
+
+class ShadowMap;
+
+// Plain copy of the counters, layout is part of the C API
+struct NullBackendStats {
+    uint64_t frames = 0;
+    uint64_t drawCalls = 0;
+    uint64_t triangles = 0;
+    uint64_t stateChanges = 0;         // binds and state calls GL would have been sent
+    uint64_t shaderBinds = 0;
+    uint64_t uniformUploads = 0;
+    uint64_t bufferUploads = 0;
+    uint64_t bytesUploaded = 0;
+    uint64_t skippedStateChanges = 0;  // redundant ones the state cache dropped
+};
+
+// Accepts every call and only counts it. Used for headless runs and for
+// benchmarking the CPU side of the renderer without a GPU in the way.
+class NullBackend : public IGraphicsBackend {
+public:
+    NullBackend() = default;
+    ~NullBackend() override;
+
+    bool Init() override;
+    void Shutdown() override;
+    BackendType GetType() const override { return BackendType::Null; }
+
+    void BeginFrame() override;
+    void EndFrame() override;
+
+    void Clear(const glm::vec4& color) override;
+    void SetViewport(int x, int y, int width, int height) override;
+
+    ShadowMap* CreateShadowMap(unsigned int width = 2048, unsigned int height = 2048) override;
+
+    void SetDepthTest(bool enabled) override;
+    void SetCullFace(bool enabled) override;
+    void SetWireframe(bool enabled) override;
+    void SetBlending(bool enabled) override;
+
+    void BindShader(int shaderID) override;
+    void SetShaderMat4(int shaderID, const std::string& name, const glm::mat4& value) override;
+    void SetShaderVec3(int shaderID, const std::string& name, const glm::vec3& value) override;
+    void SetShaderFloat(int shaderID, const std::string& name, float value) override;
+    void SetShaderInt(int shaderID, const std::string& name, int value) override;
+    void SetShaderBool(int shaderID, const std::string& name, bool value) override;
+
+    int GetUniformLocation(int shaderID, const std::string& name) override { return 0; }
+    void SetUniformMat4(int location, const glm::mat4& value) override;
+    void SetUniformVec3(int location, const glm::vec3& value) override;
+    void SetUniformFloat(int location, float value) override;
+    void SetUniformInt(int location, int value) override;
+
+    void BindTexture(unsigned int textureID, int slot = 0) override;
+    void UnbindTexture(int slot = 0) override;
+
+    void DrawIndexed(unsigned int vao, unsigned int indexCount) override;
+    void DrawArrays(unsigned int vao, unsigned int vertexCount) override;
+    void DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance) override;
+    void DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance) override;
+    void MultiDrawIndexedIndirect(unsigned int vao, unsigned int indirectBuffer, size_t offset, unsigned int drawCount, uint64_t triangleCount) override;
+
+    unsigned int CreateBuffer() override;
+    void DeleteBuffer(unsigned int bufferID) override;
+    unsigned int CreateVertexArray() override;
+    void DeleteVertexArray(unsigned int vaoID) override;
+    void UploadBufferData(unsigned int bufferID, const void* data, size_t size) override;
+    unsigned int CreateUniformBuffer(size_t size) override;
+    void UpdateBufferSubData(unsigned int bufferID, const void* data, size_t size, size_t offset = 0) override;
+    void BindUniformBuffer(unsigned int bufferID, unsigned int binding) override;
+
+    std::string GetAPIVersion() const override { return "Null"; }
+    std::string GetRendererName() const override { return "Null (headless)"; }
+
+    NullBackendStats GetStats() const;
+    void ResetStats();
+
+    // Fake object names for resources that would normally come from the API
+    unsigned int AllocateHandle() { return m_nextHandle.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    // Render threads of several engines may share the backend
+    std::atomic<uint64_t> m_frames{ 0 };
+    std::atomic<uint64_t> m_drawCalls{ 0 };
+    std::atomic<uint64_t> m_triangles{ 0 };
+    std::atomic<uint64_t> m_stateChanges{ 0 };
+    std::atomic<uint64_t> m_shaderBinds{ 0 };
+    std::atomic<uint64_t> m_uniformUploads{ 0 };
+    std::atomic<uint64_t> m_bufferUploads{ 0 };
+    std::atomic<uint64_t> m_bytesUploaded{ 0 };
+    std::atomic<uint64_t> m_skippedStateChanges{ 0 };
+
+    std::atomic<unsigned int> m_nextHandle{ 1 };
+    bool m_initialized = false;
+
+    static void Count(std::atomic<uint64_t>& counter, uint64_t amount = 1) {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    // Takes the result of a state cache setter
+    void CountState(bool issued) {
+        Count(issued ? m_stateChanges : m_skippedStateChanges);
+    }
+};
+
+#endif // NULL_BACKEND_H
@@ -11,7 +11,9 @@
 
 #include "../../common.h"
 #include "GL_backEnd.h"
+#include "GL_state_cache.h"
 #include "../../core/window.h"
+#include "../../core/telemetry.h"
 
 OpenGLBackend::~OpenGLBackend() {
     Shutdown();
@@ -42,19 +44,22 @@ void OpenGLBackend::Shutdown() {
     }
 
     m_uniformCache.clear();
-    m_currentShaderID = -1;
     m_initialized = false;
 
-    spdlog::info("OpenGL Backend shut down");
+    const GLStateCounters& totals = GLStateCache::GetCurrent().GetTotals();
+    spdlog::info("OpenGL Backend shut down, {} state calls issued, {} redundant ones skipped",
+        totals.issued, totals.skipped);
 }
 
 void OpenGLBackend::BeginFrame() {
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.SetEnabled(GL_DEPTH_TEST, true);
+    state.DepthFunc(GL_LESS);
 }
 
 void OpenGLBackend::EndFrame() {
-
+    GLStateCounters counters = GLStateCache::GetCurrent().TakeFrameCounters();
+    Telemetry::CountStateCalls(counters.issued, counters.skipped);
 }
 
 void OpenGLBackend::Clear(const glm::vec4& color) {
@@ -63,7 +68,7 @@ void OpenGLBackend::Clear(const glm::vec4& color) {
 }
 
 void OpenGLBackend::SetViewport(int x, int y, int width, int height) {
-    glViewport(x, y, width, height);
+    GLStateCache::GetCurrent().Viewport(x, y, width, height);
 }
 
 ShadowMap* OpenGLBackend::CreateShadowMap(unsigned int width, unsigned int height) {
@@ -77,50 +82,32 @@ ShadowMap* OpenGLBackend::CreateShadowMap(unsigned int width, unsigned int heigh
 }
 
 void OpenGLBackend::SetDepthTest(bool enabled) {
-    if (enabled) {
-        glEnable(GL_DEPTH_TEST);
-        glDepthFunc(GL_LESS);
-    }
-    else {
-        glDisable(GL_DEPTH_TEST);
-    }
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.SetEnabled(GL_DEPTH_TEST, enabled);
+    if (enabled) state.DepthFunc(GL_LESS);
 }
 
 void OpenGLBackend::SetCullFace(bool enabled) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.SetEnabled(GL_CULL_FACE, enabled);
     if (enabled) {
-        glEnable(GL_CULL_FACE);
-        glCullFace(GL_BACK);
-        glFrontFace(GL_CCW);
-    }
-    else {
-        glDisable(GL_CULL_FACE);
+        state.CullFace(GL_BACK);
+        state.FrontFace(GL_CCW);
     }
 }
 
 void OpenGLBackend::SetWireframe(bool enabled) {
-    if (enabled) {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    }
-    else {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    }
+    GLStateCache::GetCurrent().PolygonMode(enabled ? GL_LINE : GL_FILL);
 }
 
 void OpenGLBackend::SetBlending(bool enabled) {
-    if (enabled) {
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    }
-    else {
-        glDisable(GL_BLEND);
-    }
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.SetEnabled(GL_BLEND, enabled);
+    if (enabled) state.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
 void OpenGLBackend::BindShader(int shaderID) {
-    if (shaderID != m_currentShaderID) {
-        glUseProgram(static_cast<GLuint>(shaderID));
-        m_currentShaderID = shaderID;
-    }
+    GLStateCache::GetCurrent().UseProgram(static_cast<GLuint>(shaderID));
 }
 
 int OpenGLBackend::GetUniformLocation(int shaderID, const std::string& name) {
@@ -146,6 +133,7 @@ void OpenGLBackend::SetShaderMat4(int shaderID, const std::string& name, const g
     int location = GetUniformLocation(shaderID, name);
     if (location != -1) {
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
     }
 }
 
@@ -154,6 +142,7 @@ void OpenGLBackend::SetShaderVec3(int shaderID, const std::string& name, const g
     int location = GetUniformLocation(shaderID, name);
     if (location != -1) {
         glUniform3fv(location, 1, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
     }
 }
 
@@ -162,6 +151,7 @@ void OpenGLBackend::SetShaderFloat(int shaderID, const std::string& name, float
     int location = GetUniformLocation(shaderID, name);
     if (location != -1) {
         glUniform1f(location, value);
+        Telemetry::CountUniformUpload();
     }
 }
 
@@ -170,6 +160,7 @@ void OpenGLBackend::SetShaderInt(int shaderID, const std::string& name, int valu
     int location = GetUniformLocation(shaderID, name);
     if (location != -1) {
         glUniform1i(location, value);
+        Telemetry::CountUniformUpload();
     }
 }
 
@@ -178,17 +169,44 @@ void OpenGLBackend::SetShaderBool(int shaderID, const std::string& name, bool va
     int location = GetUniformLocation(shaderID, name);
     if (location != -1) {
         glUniform1i(location, static_cast<int>(value));
+        Telemetry::CountUniformUpload();
+    }
+}
+
+void OpenGLBackend::SetUniformMat4(int location, const glm::mat4& value) {
+    if (location != -1) {
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
+    }
+}
+
+void OpenGLBackend::SetUniformVec3(int location, const glm::vec3& value) {
+    if (location != -1) {
+        glUniform3fv(location, 1, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
+    }
+}
+
+void OpenGLBackend::SetUniformFloat(int location, float value) {
+    if (location != -1) {
+        glUniform1f(location, value);
+        Telemetry::CountUniformUpload();
+    }
+}
+
+void OpenGLBackend::SetUniformInt(int location, int value) {
+    if (location != -1) {
+        glUniform1i(location, value);
+        Telemetry::CountUniformUpload();
     }
 }
 
 void OpenGLBackend::BindTexture(unsigned int textureID, int slot) {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(slot), GL_TEXTURE_2D, textureID);
 }
 
 void OpenGLBackend::UnbindTexture(int slot) {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(slot), GL_TEXTURE_2D, 0);
 }
 
 void OpenGLBackend::DrawMesh(const Mesh* mesh) {
@@ -199,15 +217,36 @@ void OpenGLBackend::DrawMesh(const Mesh* mesh) {
 }
 
 void OpenGLBackend::DrawIndexed(unsigned int vao, unsigned int indexCount) {
-    glBindVertexArray(vao);
+    GLStateCache::GetCurrent().BindVertexArray(vao);
     glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
-    glBindVertexArray(0);
+    Telemetry::CountDrawCall(indexCount / 3);
 }
 
 void OpenGLBackend::DrawArrays(unsigned int vao, unsigned int vertexCount) {
-    glBindVertexArray(vao);
+    GLStateCache::GetCurrent().BindVertexArray(vao);
     glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-    glBindVertexArray(0);
+    Telemetry::CountDrawCall(vertexCount / 3);
+}
+
+void OpenGLBackend::DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance) {
+    GLStateCache::GetCurrent().BindVertexArray(vao);
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount, baseInstance);
+    Telemetry::CountDrawCall(static_cast<uint64_t>(indexCount / 3) * instanceCount);
+}
+
+void OpenGLBackend::DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance) {
+    GLStateCache::GetCurrent().BindVertexArray(vao);
+    glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, baseInstance);
+    Telemetry::CountDrawCall(static_cast<uint64_t>(vertexCount / 3) * instanceCount);
+}
+
+void OpenGLBackend::MultiDrawIndexedIndirect(unsigned int vao, unsigned int indirectBuffer, size_t offset, unsigned int drawCount, uint64_t triangleCount) {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(vao);
+    state.BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(offset),
+        static_cast<GLsizei>(drawCount), 0);
+    Telemetry::CountDrawCall(triangleCount);
 }
 
 unsigned int OpenGLBackend::CreateBuffer() {
@@ -219,6 +258,7 @@ unsigned int OpenGLBackend::CreateBuffer() {
 void OpenGLBackend::DeleteBuffer(unsigned int bufferID) {
     GLuint buffer = static_cast<GLuint>(bufferID);
     glDeleteBuffers(1, &buffer);
+    GLStateCache::OnObjectsDeleted();
 }
 
 unsigned int OpenGLBackend::CreateVertexArray() {
@@ -230,6 +270,32 @@ unsigned int OpenGLBackend::CreateVertexArray() {
 void OpenGLBackend::DeleteVertexArray(unsigned int vaoID) {
     GLuint vao = static_cast<GLuint>(vaoID);
     glDeleteVertexArrays(1, &vao);
+    GLStateCache::OnObjectsDeleted();
+}
+
+void OpenGLBackend::UploadBufferData(unsigned int bufferID, const void* data, size_t size) {
+    // Storage does not depend on the target, the copy target leaves any
+    // VAO or element buffer bindings alone
+    GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, bufferID);
+    glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data, GL_STATIC_DRAW);
+    Telemetry::CountBufferUpload(size);
+}
+
+unsigned int OpenGLBackend::CreateUniformBuffer(size_t size) {
+    // Immutable storage, only the contents change after creation
+    GLuint buffer = 0;
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    return static_cast<unsigned int>(buffer);
+}
+
+void OpenGLBackend::UpdateBufferSubData(unsigned int bufferID, const void* data, size_t size, size_t offset) {
+    glNamedBufferSubData(bufferID, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    Telemetry::CountBufferUpload(size);
+}
+
+void OpenGLBackend::BindUniformBuffer(unsigned int bufferID, unsigned int binding) {
+    GLStateCache::GetCurrent().BindBufferBase(GL_UNIFORM_BUFFER, binding, bufferID);
 }
 
 std::string OpenGLBackend::GetAPIVersion() const {
@@ -50,26 +50,37 @@ public:
     void SetShaderInt(int shaderID, const std::string& name, int value) override;
     void SetShaderBool(int shaderID, const std::string& name, bool value) override;
 
+    int GetUniformLocation(int shaderID, const std::string& name) override;
+    void SetUniformMat4(int location, const glm::mat4& value) override;
+    void SetUniformVec3(int location, const glm::vec3& value) override;
+    void SetUniformFloat(int location, float value) override;
+    void SetUniformInt(int location, int value) override;
+
     void BindTexture(unsigned int textureID, int slot = 0) override;
     void UnbindTexture(int slot = 0) override;
 
     void DrawMesh(const Mesh* mesh);
     void DrawIndexed(unsigned int vao, unsigned int indexCount) override;
     void DrawArrays(unsigned int vao, unsigned int vertexCount) override;
+    void DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance) override;
+    void DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance) override;
+    void MultiDrawIndexedIndirect(unsigned int vao, unsigned int indirectBuffer, size_t offset, unsigned int drawCount, uint64_t triangleCount) override;
 
     unsigned int CreateBuffer() override;
     void DeleteBuffer(unsigned int bufferID) override;
     unsigned int CreateVertexArray() override;
     void DeleteVertexArray(unsigned int vaoID) override;
+    void UploadBufferData(unsigned int bufferID, const void* data, size_t size) override;
+    unsigned int CreateUniformBuffer(size_t size) override;
+    void UpdateBufferSubData(unsigned int bufferID, const void* data, size_t size, size_t offset = 0) override;
+    void BindUniformBuffer(unsigned int bufferID, unsigned int binding) override;
 
     std::string GetAPIVersion() const override;
     std::string GetRendererName() const override;
 
 private:
-    int m_currentShaderID = -1;
     bool m_initialized = false;
 
-    int GetUniformLocation(int shaderID, const std::string& name);
     std::unordered_map<int, std::unordered_map<std::string, int>> m_uniformCache;
 };
 
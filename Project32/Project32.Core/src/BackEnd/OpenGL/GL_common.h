@@ -5,10 +5,15 @@
 
 #include "GL_backEnd.h"
 #include "GL_util.h"
+#include "GL_state_cache.h"
 
 #include "Types/GL_mesh.h"
 #include "Types/GL_textures.h"
 #include "Types/GL_shader.h"
 #include "Types/GL_skybox.h"
+#include "Types/GL_stream_buffer.h"
+#include "Types/GL_geometry_arena.h"
+#include "Types/GL_texture_buffer.h"
+#include "Types/GL_render_targets.h"
 
 #endif // GL_COMMON_H
\ No newline at end of file
@@ -0,0 +1,293 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../common.h"
+#include "GL_state_cache.h"
+#include "../backend.h"
+#include "../../core/window.h"
+
+std::atomic<uint64_t> GLStateCache::s_deleteGeneration{ 0 };
+std::mutex GLStateCache::s_slotMutex;
+std::array<GLStateCache::ContextSlot, GLStateCache::MAX_CONTEXT_SLOTS> GLStateCache::s_slots;
+std::array<std::atomic<uint32_t>, GLStateCache::MAX_CONTEXT_SLOTS> GLStateCache::s_slotGenerations{};
+
+GLStateCache::GLStateCache(bool issueCalls)
+    : _issueCalls(issueCalls), _generation(s_deleteGeneration.load(std::memory_order_acquire)) {
+    if (!issueCalls) _contextSlot = 0;
+    Invalidate();
+}
+
+GLStateCache::~GLStateCache() {
+    if (!_issueCalls || _contextSlot == INVALID_CONTEXT_SLOT) return;
+
+    std::lock_guard<std::mutex> lock(s_slotMutex);
+    ContextSlot& slot = s_slots[_contextSlot];
+    slot.inUse = false;
+    slot.queuedVertexArrays.clear();
+    s_slotGenerations[_contextSlot].fetch_add(1, std::memory_order_acq_rel);
+}
+
+bool GLStateCache::AcquireContextSlot() {
+    if (_contextSlot != INVALID_CONTEXT_SLOT) return true;
+
+    std::lock_guard<std::mutex> lock(s_slotMutex);
+    for (uint32_t i = 0; i < MAX_CONTEXT_SLOTS; ++i) {
+        if (s_slots[i].inUse) continue;
+        s_slots[i].inUse = true;
+        _contextSlot = i;
+        return true;
+    }
+
+    spdlog::error("[GLStateCache::AcquireContextSlot] All {} context slots are taken", MAX_CONTEXT_SLOTS);
+    return false;
+}
+
+void GLStateCache::DeleteVertexArrayLater(uint32_t slot, uint32_t generation, GLuint vao) {
+    if (slot >= MAX_CONTEXT_SLOTS || vao == 0) return;
+
+    std::lock_guard<std::mutex> lock(s_slotMutex);
+    if (s_slotGenerations[slot].load(std::memory_order_relaxed) != generation) return;
+    s_slots[slot].queuedVertexArrays.push_back(vao);
+}
+
+void GLStateCache::DeleteQueuedObjects() {
+    if (_contextSlot >= MAX_CONTEXT_SLOTS) return;
+
+    std::vector<GLuint> vertexArrays;
+    {
+        std::lock_guard<std::mutex> lock(s_slotMutex);
+        vertexArrays.swap(s_slots[_contextSlot].queuedVertexArrays);
+    }
+    if (vertexArrays.empty()) return;
+
+    if (_issueCalls) glDeleteVertexArrays(static_cast<GLsizei>(vertexArrays.size()), vertexArrays.data());
+    OnObjectsDeleted();
+}
+
+GLStateCache& GLStateCache::GetCurrent() {
+    if (GraphicsBackend::IsHeadless()) {
+        thread_local GLStateCache headless(false);
+        return headless;
+    }
+
+    GLFWwindow* context = glfwGetCurrentContext();
+    Window* window = context ? static_cast<Window*>(glfwGetWindowUserPointer(context)) : nullptr;
+    if (window && window->GetStateCache()) {
+        return *window->GetStateCache();
+    }
+
+    // A context the engine did not create, nothing about it can be assumed
+    thread_local GLStateCache unowned;
+    unowned.Invalidate();
+    return unowned;
+}
+
+void GLStateCache::OnObjectsDeleted() {
+    s_deleteGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void GLStateCache::ForgetObjects() {
+    _program = UNKNOWN;
+    _vertexArray = UNKNOWN;
+    _drawFramebuffer = UNKNOWN;
+    _readFramebuffer = UNKNOWN;
+    _buffers.fill(UNKNOWN);
+    _uniformBindings.fill(UNKNOWN);
+    for (auto& unit : _textures) unit.fill(UNKNOWN);
+}
+
+void GLStateCache::Invalidate() {
+    ForgetObjects();
+    _activeUnit = UNKNOWN;
+    _capabilities.fill(-1);
+    _depthFunc = UNKNOWN;
+    _blendSource = UNKNOWN;
+    _blendDestination = UNKNOWN;
+    _cullFace = UNKNOWN;
+    _frontFace = UNKNOWN;
+    _polygonMode = UNKNOWN;
+    _viewportKnown = false;
+}
+
+GLStateCounters GLStateCache::TakeFrameCounters() {
+    GLStateCounters counters = _frame;
+    _frame = {};
+    return counters;
+}
+
+int GLStateCache::GetTextureTarget(GLenum target) {
+    switch (target) {
+    case GL_TEXTURE_2D: return TEX_2D;
+    case GL_TEXTURE_2D_ARRAY: return TEX_2D_ARRAY;
+    case GL_TEXTURE_CUBE_MAP: return TEX_CUBE_MAP;
+    case GL_TEXTURE_BUFFER: return TEX_BUFFER;
+    default: return -1;
+    }
+}
+
+int GLStateCache::GetBufferTarget(GLenum target) {
+    switch (target) {
+    case GL_ARRAY_BUFFER: return BUF_ARRAY;
+    case GL_COPY_READ_BUFFER: return BUF_COPY_READ;
+    case GL_COPY_WRITE_BUFFER: return BUF_COPY_WRITE;
+    case GL_DRAW_INDIRECT_BUFFER: return BUF_DRAW_INDIRECT;
+    case GL_TEXTURE_BUFFER: return BUF_TEXTURE;
+    case GL_UNIFORM_BUFFER: return BUF_UNIFORM;
+    default: return -1;
+    }
+}
+
+int GLStateCache::GetCapability(GLenum capability) {
+    switch (capability) {
+    case GL_DEPTH_TEST: return CAP_DEPTH_TEST;
+    case GL_BLEND: return CAP_BLEND;
+    case GL_CULL_FACE: return CAP_CULL_FACE;
+    default: return -1;
+    }
+}
+
+bool GLStateCache::UseProgram(GLuint program) {
+    SyncObjects();
+    if (!Update(_program, program)) return false;
+    if (_issueCalls) glUseProgram(program);
+    return true;
+}
+
+bool GLStateCache::BindVertexArray(GLuint vao) {
+    SyncObjects();
+    if (!Update(_vertexArray, vao)) return false;
+    if (_issueCalls) glBindVertexArray(vao);
+    return true;
+}
+
+bool GLStateCache::BindBuffer(GLenum target, GLuint buffer) {
+    SyncObjects();
+    int index = GetBufferTarget(target);
+    if (index < 0) {
+        Pass();
+    }
+    else if (!Update(_buffers[index], buffer)) {
+        return false;
+    }
+    if (_issueCalls) glBindBuffer(target, buffer);
+    return true;
+}
+
+bool GLStateCache::BindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    SyncObjects();
+
+    // Also replaces the generic binding of the target
+    int generic = GetBufferTarget(target);
+    if (target == GL_UNIFORM_BUFFER && index < MAX_BUFFER_BINDINGS) {
+        if (_uniformBindings[index] == buffer && _buffers[generic] == buffer) return Skip();
+        _uniformBindings[index] = buffer;
+    }
+    if (generic >= 0) _buffers[generic] = buffer;
+
+    Pass();
+    if (_issueCalls) glBindBufferBase(target, index, buffer);
+    return true;
+}
+
+bool GLStateCache::BindFramebuffer(GLenum target, GLuint framebuffer) {
+    SyncObjects();
+    if (target == GL_FRAMEBUFFER) {
+        if (_drawFramebuffer == framebuffer && _readFramebuffer == framebuffer) return Skip();
+        _drawFramebuffer = framebuffer;
+        _readFramebuffer = framebuffer;
+        Pass();
+    }
+    else if (!Update(target == GL_READ_FRAMEBUFFER ? _readFramebuffer : _drawFramebuffer, framebuffer)) {
+        return false;
+    }
+    if (_issueCalls) glBindFramebuffer(target, framebuffer);
+    return true;
+}
+
+bool GLStateCache::ActiveTexture(GLuint unit) {
+    if (!Update(_activeUnit, unit)) return false;
+    if (_issueCalls) glActiveTexture(GL_TEXTURE0 + unit);
+    return true;
+}
+
+bool GLStateCache::BindTexture(GLuint unit, GLenum target, GLuint texture) {
+    SyncObjects();
+    int index = GetTextureTarget(target);
+    if (index >= 0 && unit < MAX_TEXTURE_UNITS) {
+        GLuint& current = _textures[unit][index];
+        if (current == texture) return Skip();
+        current = texture;
+    }
+
+    ActiveTexture(unit);
+    Pass();
+    if (_issueCalls) glBindTexture(target, texture);
+    return true;
+}
+
+bool GLStateCache::SetEnabled(GLenum capability, bool enabled) {
+    int index = GetCapability(capability);
+    if (index >= 0) {
+        int8_t value = enabled ? 1 : 0;
+        if (_capabilities[index] == value) return Skip();
+        _capabilities[index] = value;
+    }
+
+    Pass();
+    if (_issueCalls) {
+        if (enabled) glEnable(capability);
+        else glDisable(capability);
+    }
+    return true;
+}
+
+bool GLStateCache::DepthFunc(GLenum func) {
+    if (!Update(_depthFunc, func)) return false;
+    if (_issueCalls) glDepthFunc(func);
+    return true;
+}
+
+bool GLStateCache::BlendFunc(GLenum source, GLenum destination) {
+    if (_blendSource == source && _blendDestination == destination) return Skip();
+    _blendSource = source;
+    _blendDestination = destination;
+    Pass();
+    if (_issueCalls) glBlendFunc(source, destination);
+    return true;
+}
+
+bool GLStateCache::CullFace(GLenum face) {
+    if (!Update(_cullFace, face)) return false;
+    if (_issueCalls) glCullFace(face);
+    return true;
+}
+
+bool GLStateCache::FrontFace(GLenum mode) {
+    if (!Update(_frontFace, mode)) return false;
+    if (_issueCalls) glFrontFace(mode);
+    return true;
+}
+
+bool GLStateCache::PolygonMode(GLenum mode) {
+    if (!Update(_polygonMode, mode)) return false;
+    if (_issueCalls) glPolygonMode(GL_FRONT_AND_BACK, mode);
+    return true;
+}
+
+bool GLStateCache::Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    std::array<GLint, 4> viewport{ x, y, width, height };
+    if (_viewportKnown && _viewport == viewport) return Skip();
+    _viewport = viewport;
+    _viewportKnown = true;
+    Pass();
+    if (_issueCalls) glViewport(x, y, width, height);
+    return true;
+}
@@ -0,0 +1,182 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include "../../common.h"
+
+struct GLStateCounters {
+    uint64_t issued = 0;
+    uint64_t skipped = 0;
+};
+
+// Shadow copy of the state of one GL context. Every setter compares against
+// the last value it issued and skips the call when it would change nothing,
+// state the cache has not set yet is unknown and always issued. Setters
+// return true when the call went through.
+//
+// A context is only ever current on one thread, so nothing here is locked.
+//
+// The caches of engine windows also hold a context slot. All engine
+// contexts share objects, but vertex arrays and framebuffers stay per
+// context, so shared meshes keep one vertex array per slot. A released
+// slot gets a new generation, objects still recorded for the old one died
+// with its context.
+class GLStateCache {
+public:
+    static constexpr uint32_t MAX_TEXTURE_UNITS = 16;
+    static constexpr uint32_t MAX_BUFFER_BINDINGS = 16;
+    static constexpr uint32_t MAX_CONTEXT_SLOTS = 16;
+    static constexpr uint32_t INVALID_CONTEXT_SLOT = UINT32_MAX;
+
+    // Without issueCalls the cache only tracks and counts, for headless runs.
+    // Headless caches all use slot 0, the null backend has no contexts.
+    explicit GLStateCache(bool issueCalls = true);
+    ~GLStateCache();
+
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    // Cache of the context current on the calling thread. Headless threads
+    // get a counting-only cache of their own.
+    static GLStateCache& GetCurrent();
+
+    // Deleted names are unbound in the deleting context only and may be
+    // handed out again, shared contexts included, so every cache forgets
+    // its object bindings before its next call
+    static void OnObjectsDeleted();
+    static uint64_t GetDeleteGeneration() { return s_deleteGeneration.load(std::memory_order_acquire); }
+
+    // Called once by the owning window, false when every slot is taken
+    bool AcquireContextSlot();
+    uint32_t GetContextSlot() const { return _contextSlot; }
+    static uint32_t GetSlotGeneration(uint32_t slot) {
+        return slot < MAX_CONTEXT_SLOTS ? s_slotGenerations[slot].load(std::memory_order_acquire) : 0;
+    }
+
+    // Per context objects can only be deleted while their context is
+    // current. Queues one for the context holding slot, dropped when that
+    // context went away in the meantime.
+    static void DeleteVertexArrayLater(uint32_t slot, uint32_t generation, GLuint vao);
+
+    // Deletes what other threads queued for this context
+    void DeleteQueuedObjects();
+
+    bool UseProgram(GLuint program);
+    bool BindVertexArray(GLuint vao);
+
+    // Element array bindings belong to the bound VAO and are never skipped
+    bool BindBuffer(GLenum target, GLuint buffer);
+    bool BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+    bool BindFramebuffer(GLenum target, GLuint framebuffer);
+
+    // Binds on the given unit, switching the active unit only when needed
+    bool BindTexture(GLuint unit, GLenum target, GLuint texture);
+
+    bool SetEnabled(GLenum capability, bool enabled);
+    bool DepthFunc(GLenum func);
+    bool BlendFunc(GLenum source, GLenum destination);
+    bool CullFace(GLenum face);
+    bool FrontFace(GLenum mode);
+    bool PolygonMode(GLenum mode);
+    bool Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    // Forget everything, for code that changed state behind the cache
+    void Invalidate();
+
+    const GLStateCounters& GetTotals() const { return _totals; }
+
+    // Counts since the previous call
+    GLStateCounters TakeFrameCounters();
+
+private:
+    static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;
+
+    enum TextureTarget : uint32_t { TEX_2D, TEX_2D_ARRAY, TEX_CUBE_MAP, TEX_BUFFER, TEX_TARGET_COUNT };
+    enum BufferTarget : uint32_t { BUF_ARRAY, BUF_COPY_READ, BUF_COPY_WRITE, BUF_DRAW_INDIRECT, BUF_TEXTURE, BUF_UNIFORM, BUF_TARGET_COUNT };
+    enum Capability : uint32_t { CAP_DEPTH_TEST, CAP_BLEND, CAP_CULL_FACE, CAP_COUNT };
+
+    bool _issueCalls;
+    uint64_t _generation = 0;
+    uint32_t _contextSlot = INVALID_CONTEXT_SLOT;
+
+    GLuint _program = UNKNOWN;
+    GLuint _vertexArray = UNKNOWN;
+    GLuint _drawFramebuffer = UNKNOWN;
+    GLuint _readFramebuffer = UNKNOWN;
+    GLuint _activeUnit = UNKNOWN;
+    std::array<GLuint, BUF_TARGET_COUNT> _buffers;
+    std::array<GLuint, MAX_BUFFER_BINDINGS> _uniformBindings;
+    std::array<std::array<GLuint, TEX_TARGET_COUNT>, MAX_TEXTURE_UNITS> _textures;
+
+    std::array<int8_t, CAP_COUNT> _capabilities;    // -1 unknown
+    GLenum _depthFunc = UNKNOWN;
+    GLenum _blendSource = UNKNOWN;
+    GLenum _blendDestination = UNKNOWN;
+    GLenum _cullFace = UNKNOWN;
+    GLenum _frontFace = UNKNOWN;
+    GLenum _polygonMode = UNKNOWN;
+    std::array<GLint, 4> _viewport{};
+    bool _viewportKnown = false;
+
+    GLStateCounters _totals;
+    GLStateCounters _frame;
+
+    static std::atomic<uint64_t> s_deleteGeneration;
+
+    struct ContextSlot {
+        bool inUse = false;
+        std::vector<GLuint> queuedVertexArrays;
+    };
+    static std::mutex s_slotMutex;
+    static std::array<ContextSlot, MAX_CONTEXT_SLOTS> s_slots;
+
+    // Read per recorded draw, so kept outside the lock. Only changed with
+    // s_slotMutex held.
+    static std::array<std::atomic<uint32_t>, MAX_CONTEXT_SLOTS> s_slotGenerations;
+
+    void ForgetObjects();
+    void SyncObjects() {
+        uint64_t generation = s_deleteGeneration.load(std::memory_order_acquire);
+        if (generation != _generation) {
+            ForgetObjects();
+            _generation = generation;
+        }
+    }
+
+    bool Pass() {
+        ++_totals.issued;
+        ++_frame.issued;
+        return true;
+    }
+    bool Skip() {
+        ++_totals.skipped;
+        ++_frame.skipped;
+        return false;
+    }
+
+    // Compares and stores, true when the call has to be issued
+    bool Update(GLuint& current, GLuint value) {
+        if (current == value) return Skip();
+        current = value;
+        return Pass();
+    }
+    bool ActiveTexture(GLuint unit);
+
+    static int GetTextureTarget(GLenum target);
+    static int GetBufferTarget(GLenum target);
+    static int GetCapability(GLenum capability);
+};
+
+#endif // GL_STATE_CACHE_H
@@ -0,0 +1,265 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../../common.h"
+#include "GL_geometry_arena.h"
+#include "../GL_state_cache.h"
+#include "GL_mesh.h"
+
+void RangeAllocator::Reset(uint32_t capacity) {
+    _capacity = capacity;
+    _free.clear();
+    if (capacity > 0) _free.push_back({ 0, capacity });
+}
+
+void RangeAllocator::Grow(uint32_t capacity) {
+    if (capacity <= _capacity) return;
+
+    uint32_t added = capacity - _capacity;
+    uint32_t oldCapacity = _capacity;
+    _capacity = capacity;
+    Free(oldCapacity, added);
+}
+
+uint32_t RangeAllocator::Allocate(uint32_t size) {
+    for (size_t i = 0; i < _free.size(); ++i) {
+        Block& block = _free[i];
+        if (block.size < size) continue;
+
+        uint32_t offset = block.offset;
+        block.offset += size;
+        block.size -= size;
+        if (block.size == 0) _free.erase(_free.begin() + i);
+        return offset;
+    }
+    return UINT32_MAX;
+}
+
+void RangeAllocator::Free(uint32_t offset, uint32_t size) {
+    if (size == 0) return;
+
+    // Free list is kept sorted by offset so neighbours can merge
+    auto it = std::lower_bound(_free.begin(), _free.end(), offset,
+        [](const Block& block, uint32_t value) { return block.offset < value; });
+    it = _free.insert(it, { offset, size });
+
+    auto next = it + 1;
+    if (next != _free.end() && it->offset + it->size == next->offset) {
+        it->size += next->size;
+        _free.erase(next);
+    }
+
+    if (it != _free.begin()) {
+        auto prev = it - 1;
+        if (prev->offset + prev->size == it->offset) {
+            prev->size += it->size;
+            _free.erase(it);
+        }
+    }
+}
+
+GeometryArena::GeometryArena(uint32_t vertexCapacity, uint32_t indexCapacity) {
+    _vertices.Reset(vertexCapacity);
+    _indices.Reset(indexCapacity);
+}
+
+GeometryArena::~GeometryArena() {
+    Cleanup();
+}
+
+bool GeometryArena::Initialize() {
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    if (!backend) return false;
+
+    if (!GraphicsBackend::IsHeadless() && !GLAD_GL_VERSION_4_3) {
+        spdlog::warn("[GeometryArena::Initialize] Multi-draw indirect needs GL 4.3, arena disabled");
+        return false;
+    }
+
+    _VAO = backend->CreateVertexArray();
+    _VBO = backend->CreateBuffer();
+    _EBO = backend->CreateBuffer();
+
+    if (!GraphicsBackend::IsHeadless()) {
+        GLStateCache& state = GLStateCache::GetCurrent();
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, _VBO);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(_vertices.GetCapacity()) * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, _EBO);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(_indices.GetCapacity()) * sizeof(unsigned int), nullptr, GL_STATIC_DRAW);
+        SetupVertexArray();
+    }
+
+    spdlog::info("[GeometryArena::Initialize] {} vertices, {} indices",
+        _vertices.GetCapacity(), _indices.GetCapacity());
+    return true;
+}
+
+void GeometryArena::Cleanup() {
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    if (backend) {
+        if (_VAO != 0) backend->DeleteVertexArray(_VAO);
+        if (_VBO != 0) backend->DeleteBuffer(_VBO);
+        if (_EBO != 0) backend->DeleteBuffer(_EBO);
+    }
+
+    _VAO = 0;
+    _VBO = 0;
+    _EBO = 0;
+    _instanceBuffer = 0;
+    _ranges.clear();
+    _usedVertices = 0;
+    _usedIndices = 0;
+    _vertices.Reset(_vertices.GetCapacity());
+    _indices.Reset(_indices.GetCapacity());
+}
+
+void GeometryArena::SetupVertexArray() {
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(_VAO);
+    state.BindBuffer(GL_ARRAY_BUFFER, _VBO);
+    state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, _EBO);
+    Mesh::SetupVertexAttributes();
+}
+
+bool GeometryArena::GrowBuffer(GLuint& buffer, size_t oldBytes, size_t newBytes) {
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    GLuint grown = backend->CreateBuffer();
+    if (grown == 0) return false;
+
+    if (!GraphicsBackend::IsHeadless()) {
+        GLStateCache& state = GLStateCache::GetCurrent();
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, grown);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(newBytes), nullptr, GL_STATIC_DRAW);
+        state.BindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(oldBytes));
+    }
+
+    backend->DeleteBuffer(buffer);
+    buffer = grown;
+    return true;
+}
+
+bool GeometryArena::Reserve(uint32_t vertexCount, uint32_t indexCount) {
+    bool grown = false;
+
+    if (vertexCount > _vertices.GetCapacity() - _usedVertices) {
+        uint32_t capacity = std::max(_vertices.GetCapacity() * 2, _usedVertices + vertexCount);
+        if (!GrowBuffer(_VBO, static_cast<size_t>(_vertices.GetCapacity()) * sizeof(Vertex),
+            static_cast<size_t>(capacity) * sizeof(Vertex))) return false;
+        _vertices.Grow(capacity);
+        grown = true;
+    }
+
+    if (indexCount > _indices.GetCapacity() - _usedIndices) {
+        uint32_t capacity = std::max(_indices.GetCapacity() * 2, _usedIndices + indexCount);
+        if (!GrowBuffer(_EBO, static_cast<size_t>(_indices.GetCapacity()) * sizeof(unsigned int),
+            static_cast<size_t>(capacity) * sizeof(unsigned int))) return false;
+        _indices.Grow(capacity);
+        grown = true;
+    }
+
+    if (grown) {
+        if (!GraphicsBackend::IsHeadless()) SetupVertexArray();
+        spdlog::info("[GeometryArena::Reserve] Grew to {} vertices, {} indices",
+            _vertices.GetCapacity(), _indices.GetCapacity());
+    }
+    return true;
+}
+
+GeometryRange GeometryArena::Add(const Mesh& mesh) {
+    auto it = _ranges.find(&mesh);
+    if (it != _ranges.end()) return it->second;
+
+    if (_VAO == 0 || !mesh.IsValid() || !mesh.IsIndexed()) return {};
+
+    uint32_t vertexCount = mesh.GetVertexCount();
+    uint32_t indexCount = mesh.GetIndexCount();
+
+    uint32_t baseVertex = _vertices.Allocate(vertexCount);
+    uint32_t firstIndex = _indices.Allocate(indexCount);
+
+    // Fragmented or full, grow and try once more
+    if (baseVertex == UINT32_MAX || firstIndex == UINT32_MAX) {
+        if (baseVertex != UINT32_MAX) _vertices.Free(baseVertex, vertexCount);
+        if (firstIndex != UINT32_MAX) _indices.Free(firstIndex, indexCount);
+
+        uint32_t vertexGrowth = std::max(vertexCount, _vertices.GetCapacity() - _usedVertices + 1);
+        uint32_t indexGrowth = std::max(indexCount, _indices.GetCapacity() - _usedIndices + 1);
+        if (!Reserve(baseVertex == UINT32_MAX ? vertexGrowth : 0, firstIndex == UINT32_MAX ? indexGrowth : 0)) {
+            spdlog::error("[GeometryArena::Add] Failed to grow for mesh '{}'", mesh.GetName());
+            return {};
+        }
+
+        baseVertex = _vertices.Allocate(vertexCount);
+        firstIndex = _indices.Allocate(indexCount);
+        if (baseVertex == UINT32_MAX || firstIndex == UINT32_MAX) {
+            spdlog::error("[GeometryArena::Add] No room for mesh '{}'", mesh.GetName());
+            return {};
+        }
+    }
+
+    if (!GraphicsBackend::IsHeadless()) {
+        GLStateCache& state = GLStateCache::GetCurrent();
+        state.BindBuffer(GL_COPY_READ_BUFFER, mesh.GetVBO());
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, _VBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0,
+            static_cast<GLintptr>(baseVertex) * sizeof(Vertex),
+            static_cast<GLsizeiptr>(vertexCount) * sizeof(Vertex));
+
+        state.BindBuffer(GL_COPY_READ_BUFFER, mesh.GetEBO());
+        state.BindBuffer(GL_COPY_WRITE_BUFFER, _EBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0,
+            static_cast<GLintptr>(firstIndex) * sizeof(unsigned int),
+            static_cast<GLsizeiptr>(indexCount) * sizeof(unsigned int));
+    }
+
+    GeometryRange range;
+    range.firstIndex = firstIndex;
+    range.indexCount = indexCount;
+    range.baseVertex = baseVertex;
+    range.vertexCount = vertexCount;
+
+    _ranges.emplace(&mesh, range);
+    _usedVertices += vertexCount;
+    _usedIndices += indexCount;
+
+    spdlog::debug("[GeometryArena] Added mesh '{}' at vertex {}, index {}", mesh.GetName(), baseVertex, firstIndex);
+    return range;
+}
+
+void GeometryArena::Remove(const Mesh& mesh) {
+    auto it = _ranges.find(&mesh);
+    if (it == _ranges.end()) return;
+
+    const GeometryRange& range = it->second;
+    _vertices.Free(range.baseVertex, range.vertexCount);
+    _indices.Free(range.firstIndex, range.indexCount);
+    _usedVertices -= range.vertexCount;
+    _usedIndices -= range.indexCount;
+    _ranges.erase(it);
+}
+
+const GeometryRange* GeometryArena::Find(const Mesh& mesh) const {
+    auto it = _ranges.find(&mesh);
+    return it != _ranges.end() ? &it->second : nullptr;
+}
+
+void GeometryArena::AttachInstanceBuffer(GLuint buffer) {
+    if (_VAO == 0 || _instanceBuffer == buffer) return;
+    _instanceBuffer = buffer;
+
+    if (GraphicsBackend::IsHeadless()) return;
+
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(_VAO);
+    state.BindBuffer(GL_ARRAY_BUFFER, buffer);
+    Mesh::SetupInstanceAttributes();
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef GL_GEOMETRY_ARENA_H
+#define GL_GEOMETRY_ARENA_H
+
+#include "../../../common.h"
+
+class Mesh;
+
+// Where a mesh lives inside the arena, in elements, matches the fields of
+// an indirect draw command
+struct GeometryRange {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    uint32_t baseVertex = 0;
+    uint32_t vertexCount = 0;
+
+    bool IsValid() const { return indexCount != 0; }
+};
+
+// First fit allocator over [0, capacity) that merges neighbouring free blocks
+class RangeAllocator {
+private:
+    struct Block {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    std::vector<Block> _free;
+    uint32_t _capacity = 0;
+
+public:
+    void Reset(uint32_t capacity);
+    void Grow(uint32_t capacity);
+
+    // UINT32_MAX when no block is large enough
+    uint32_t Allocate(uint32_t size);
+    void Free(uint32_t offset, uint32_t size);
+
+    uint32_t GetCapacity() const { return _capacity; }
+};
+
+// One VAO, vertex buffer and index buffer shared by every indexed mesh with
+// the standard Vertex layout. Meshes are copied in on the GPU from their own
+// buffers, so draws of different meshes need no VAO change and a whole pass
+// can go out as one glMultiDrawElementsIndirect. VAOs are per context, so
+// each renderer owns its own arena.
+class GeometryArena {
+private:
+    GLuint _VAO = 0;
+    GLuint _VBO = 0;
+    GLuint _EBO = 0;
+    GLuint _instanceBuffer = 0;
+
+    RangeAllocator _vertices;
+    RangeAllocator _indices;
+    std::unordered_map<const Mesh*, GeometryRange> _ranges;
+    uint32_t _usedVertices = 0;
+    uint32_t _usedIndices = 0;
+
+    bool GrowBuffer(GLuint& buffer, size_t oldBytes, size_t newBytes);
+    bool Reserve(uint32_t vertexCount, uint32_t indexCount);
+    void SetupVertexArray();
+
+public:
+    GeometryArena(uint32_t vertexCapacity = 65536, uint32_t indexCapacity = 262144);
+    ~GeometryArena();
+
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    // Fails when the context cannot multi-draw indirect (GL < 4.3)
+    bool Initialize();
+    void Cleanup();
+
+    // Copies the mesh in on first use, later calls return the same range.
+    // Non-indexed meshes are not supported and return an invalid range.
+    GeometryRange Add(const Mesh& mesh);
+    void Remove(const Mesh& mesh);
+    const GeometryRange* Find(const Mesh& mesh) const;
+
+    // Same attribute layout as Mesh::AttachInstanceBuffer
+    void AttachInstanceBuffer(GLuint buffer);
+
+    GLuint GetVAO() const { return _VAO; }
+    uint32_t GetUsedVertices() const { return _usedVertices; }
+    uint32_t GetUsedIndices() const { return _usedIndices; }
+    size_t GetMeshCount() const { return _ranges.size(); }
+};
+
+#endif // GL_GEOMETRY_ARENA_H
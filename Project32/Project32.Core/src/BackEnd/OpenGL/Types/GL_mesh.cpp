@@ -12,6 +12,7 @@
 #include "../../../common.h"
 
 #include "GL_mesh.h"
+#include "../GL_state_cache.h"
 #include "../../../renderer/vertex.h"
 
 Mesh::~Mesh() {
@@ -19,7 +20,7 @@ Mesh::~Mesh() {
 }
 
 Mesh::Mesh(Mesh&& other) noexcept
-    : _VAO(other._VAO)
+    : _vertexArrays(other._vertexArrays)
     , _VBO(other._VBO)
     , _EBO(other._EBO)
     , _indexCount(other._indexCount)
@@ -28,7 +29,7 @@ Mesh::Mesh(Mesh&& other) noexcept
     , m_isLoaded(other.m_isLoaded)
     , m_bounds(other.m_bounds)
 {
-    other._VAO = 0;
+    other._vertexArrays = {};
     other._VBO = 0;
     other._EBO = 0;
     other._indexCount = 0;
@@ -40,7 +41,7 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
     if (this != &other) {
         Cleanup();
 
-        _VAO = other._VAO;
+        _vertexArrays = other._vertexArrays;
         _VBO = other._VBO;
         _EBO = other._EBO;
         _indexCount = other._indexCount;
@@ -49,7 +50,7 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
         m_isLoaded = other.m_isLoaded;
         m_bounds = other.m_bounds;
 
-        other._VAO = 0;
+        other._vertexArrays = {};
         other._VBO = 0;
         other._EBO = 0;
         other._indexCount = 0;
@@ -84,6 +85,7 @@ void Mesh::LoadData(const std::vector<Vertex>& vertices,
     _indexCount = static_cast<GLuint>(indices.size());
     _vertexCount = static_cast<GLuint>(verticesCopy.size());
     m_isLoaded = true;
+    PrepareContext();
 
     spdlog::debug("[Mesh] Loaded indexed mesh '{}': {} vertices, {} indices",
         _name, _vertexCount, _indexCount);
@@ -101,6 +103,7 @@ void Mesh::LoadData(const std::vector<Vertex>& vertices) {
     _vertexCount = static_cast<GLuint>(vertices.size());
     _indexCount = 0;
     m_isLoaded = true;
+    PrepareContext();
 
     spdlog::debug("[Mesh] Loaded non-indexed mesh '{}': {} vertices", _name, _vertexCount);
 }
@@ -111,16 +114,15 @@ void Mesh::Draw() const {
         return;
     }
 
-    glBindVertexArray(_VAO);
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    GLuint vao = GetVAO();
 
     if (IsIndexed()) {
-        glDrawElements(GL_TRIANGLES, _indexCount, GL_UNSIGNED_INT, nullptr);
+        backend->DrawIndexed(vao, _indexCount);
     }
     else {
-        glDrawArrays(GL_TRIANGLES, 0, _vertexCount);
+        backend->DrawArrays(vao, _vertexCount);
     }
-
-    glBindVertexArray(0);
 }
 
 void Mesh::DrawInstanced(unsigned int instanceCount) const {
@@ -134,31 +136,125 @@ void Mesh::DrawInstanced(unsigned int instanceCount) const {
         return;
     }
 
-    glBindVertexArray(_VAO);
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    GLuint vao = GetVAO();
 
     if (IsIndexed()) {
-        glDrawElementsInstanced(GL_TRIANGLES, _indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+        backend->DrawIndexedInstanced(vao, _indexCount, instanceCount);
     }
     else {
-        glDrawArraysInstanced(GL_TRIANGLES, 0, _vertexCount, instanceCount);
+        backend->DrawArraysInstanced(vao, _vertexCount, instanceCount);
     }
+}
 
-    glBindVertexArray(0);
+GLuint Mesh::GetVAO() const {
+    return GetVAO(GLStateCache::GetCurrent().GetContextSlot());
 }
 
-void Mesh::Cleanup() {
-    if (_VAO != 0) {
-        glDeleteVertexArrays(1, &_VAO);
-        _VAO = 0;
+GLuint Mesh::GetVAO(uint32_t contextSlot) const {
+    if (contextSlot >= _vertexArrays.size()) return 0;
+    const ContextVertexArray& entry = _vertexArrays[contextSlot];
+    return entry.slotGeneration == GLStateCache::GetSlotGeneration(contextSlot) ? entry.vao : 0;
+}
+
+Mesh::ContextVertexArray* Mesh::GetContextVertexArray(uint32_t slot) {
+    if (slot >= _vertexArrays.size()) return nullptr;
+
+    // Left behind by a context that no longer exists, its VAO went with it
+    ContextVertexArray& entry = _vertexArrays[slot];
+    uint32_t generation = GLStateCache::GetSlotGeneration(slot);
+    if (entry.slotGeneration != generation) {
+        entry = {};
+        entry.slotGeneration = generation;
     }
+    return &entry;
+}
 
-    if (_VBO != 0) {
-        glDeleteBuffers(1, &_VBO);
-        _VBO = 0;
+bool Mesh::PrepareContext() {
+    if (!IsValid()) return false;
+
+    ContextVertexArray* entry = GetContextVertexArray(GLStateCache::GetCurrent().GetContextSlot());
+    if (!entry) return false;
+    if (entry->vao != 0) return true;
+
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    entry->vao = backend->CreateVertexArray();
+
+    // Only GL records a vertex layout, the null backend stops here
+    if (GraphicsBackend::IsHeadless()) return entry->vao != 0;
+
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(entry->vao);
+    state.BindBuffer(GL_ARRAY_BUFFER, _VBO);
+    if (_EBO != 0) state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, _EBO);
+    SetupVertexAttributes();
+    return entry->vao != 0;
+}
+
+void Mesh::AttachInstanceBuffer(GLuint buffer) {
+    if (!PrepareContext()) return;
+
+    ContextVertexArray* entry = GetContextVertexArray(GLStateCache::GetCurrent().GetContextSlot());
+    if (entry->instanceBuffer == buffer) return;
+    entry->instanceBuffer = buffer;
+
+    if (GraphicsBackend::IsHeadless()) return;
+
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(entry->vao);
+    state.BindBuffer(GL_ARRAY_BUFFER, buffer);
+    SetupInstanceAttributes();
+}
+
+void Mesh::SetupInstanceAttributes() {
+    // Model matrix takes one attribute per column (locations 6 to 9)
+    for (GLuint column = 0; column < 4; ++column) {
+        GLuint location = 6 + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+            (void*)(offsetof(InstanceData, model) + sizeof(glm::vec4) * column));
+        glVertexAttribDivisor(location, 1);
     }
 
-    if (_EBO != 0) {
-        glDeleteBuffers(1, &_EBO);
+    glEnableVertexAttribArray(10);
+    glVertexAttribPointer(10, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+        (void*)offsetof(InstanceData, color));
+    glVertexAttribDivisor(10, 1);
+
+    glEnableVertexAttribArray(11);
+    glVertexAttribPointer(11, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+        (void*)offsetof(InstanceData, material));
+    glVertexAttribDivisor(11, 1);
+}
+
+void Mesh::DeleteVertexArrays() {
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    uint32_t currentSlot = GLStateCache::GetCurrent().GetContextSlot();
+
+    for (uint32_t slot = 0; slot < _vertexArrays.size(); ++slot) {
+        ContextVertexArray& entry = _vertexArrays[slot];
+        if (entry.vao == 0) continue;
+
+        if (slot == currentSlot) {
+            if (entry.slotGeneration == GLStateCache::GetSlotGeneration(slot)) backend->DeleteVertexArray(entry.vao);
+        }
+        else {
+            GLStateCache::DeleteVertexArrayLater(slot, entry.slotGeneration, entry.vao);
+        }
+    }
+    _vertexArrays = {};
+}
+
+void Mesh::Cleanup() {
+    DeleteVertexArrays();
+
+    if (_VBO != 0 || _EBO != 0) {
+        IGraphicsBackend* backend = GraphicsBackend::Get();
+
+        if (_VBO != 0) backend->DeleteBuffer(_VBO);
+        if (_EBO != 0) backend->DeleteBuffer(_EBO);
+
+        _VBO = 0;
         _EBO = 0;
     }
 
@@ -205,23 +301,27 @@ void Mesh::SetupMesh(const std::vector<Vertex>& vertices,
     const std::vector<unsigned int>& indices) {
     Cleanup();
 
-    // Generate buffers
-    glGenVertexArrays(1, &_VAO);
-    glGenBuffers(1, &_VBO);
-    glGenBuffers(1, &_EBO);
+    IGraphicsBackend* backend = GraphicsBackend::Get();
 
-    glBindVertexArray(_VAO);
+    // Buffers are shared by every context, vertex arrays are created per
+    // context by PrepareContext once the mesh is loaded
+    _VBO = backend->CreateBuffer();
+    _EBO = backend->CreateBuffer();
 
-    // Load vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, _VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex),
-        vertices.data(), GL_STATIC_DRAW);
+    backend->UploadBufferData(_VBO, vertices.data(), vertices.size() * sizeof(Vertex));
+    backend->UploadBufferData(_EBO, indices.data(), indices.size() * sizeof(unsigned int));
+}
 
-    // Load index data
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int),
-        indices.data(), GL_STATIC_DRAW);
+void Mesh::SetupMesh(const std::vector<Vertex>& vertices) {
+    Cleanup();
 
+    IGraphicsBackend* backend = GraphicsBackend::Get();
+    _VBO = backend->CreateBuffer();
+
+    backend->UploadBufferData(_VBO, vertices.data(), vertices.size() * sizeof(Vertex));
+}
+
+void Mesh::SetupVertexAttributes() {
     // Position attribute (location 0)
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
@@ -251,50 +351,6 @@ void Mesh::SetupMesh(const std::vector<Vertex>& vertices,
     glEnableVertexAttribArray(5);
     glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
         (void*)offsetof(Vertex, bitangent));
-
-    glBindVertexArray(0);
-}
-
-void Mesh::SetupMesh(const std::vector<Vertex>& vertices) {
-    Cleanup();
-
-    // Generate buffers
-    glGenVertexArrays(1, &_VAO);
-    glGenBuffers(1, &_VBO);
-
-    glBindVertexArray(_VAO);
-
-    // Load vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, _VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex),
-        vertices.data(), GL_STATIC_DRAW);
-
-    // Attribute pointers (same as indexed version)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, position));
-
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, normal));
-
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, texCoord));
-
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, color));
-
-    glEnableVertexAttribArray(4);
-    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, tangent));
-
-    glEnableVertexAttribArray(5);
-    glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-        (void*)offsetof(Vertex, bitangent));
-
-    glBindVertexArray(0);
 }
 
 // MeshCache Implementation
@@ -35,7 +35,15 @@ public:
     };
 
 private:
-    GLuint _VAO = 0;
+    // Vertex arrays are not shared between contexts, every context that
+    // draws the mesh gets its own over the shared buffers
+    struct ContextVertexArray {
+        GLuint vao = 0;
+        GLuint instanceBuffer = 0;
+        uint32_t slotGeneration = 0;
+    };
+
+    std::array<ContextVertexArray, GLStateCache::MAX_CONTEXT_SLOTS> _vertexArrays{};
     GLuint _VBO = 0;
     GLuint _EBO = 0;
     GLuint _indexCount = 0;
@@ -66,10 +74,12 @@ public:
     [[nodiscard]] const std::string& GetName() const { return _name; }
     [[nodiscard]] GLuint GetIndexCount() const { return _indexCount; }
     [[nodiscard]] GLuint GetVertexCount() const { return _vertexCount; }
-    [[nodiscard]] GLuint GetVAO() const { return _VAO; }
+    // Vertex array of the current context, or of the context holding slot
+    [[nodiscard]] GLuint GetVAO() const;
+    [[nodiscard]] GLuint GetVAO(uint32_t contextSlot) const;
     [[nodiscard]] GLuint GetVBO() const { return _VBO; }
     [[nodiscard]] GLuint GetEBO() const { return _EBO; }
-    [[nodiscard]] bool IsValid() const { return _VAO != 0 && m_isLoaded; }
+    [[nodiscard]] bool IsValid() const { return _VBO != 0 && m_isLoaded; }
     [[nodiscard]] bool IsIndexed() const { return _indexCount > 0; }
     [[nodiscard]] const Bounds& GetBounds() const { return m_bounds; }
 
@@ -78,9 +88,25 @@ public:
     void Draw() const;
     void DrawInstanced(unsigned int instanceCount) const;
 
+    // Creates the vertex array of the current context if it has none yet.
+    // Runs on the thread of that context before draws of the mesh are
+    // recorded anywhere.
+    bool PrepareContext();
+
+    // Points the InstanceData attributes of the current context's VAO at
+    // the buffer, only touches GL when the buffer changes
+    void AttachInstanceBuffer(GLuint buffer);
+
     void Cleanup();
 
+    // Attribute layouts for the bound VAO, per vertex (locations 0 to 5)
+    // from GL_ARRAY_BUFFER and per instance (6 to 11) from the bound buffer
+    static void SetupVertexAttributes();
+    static void SetupInstanceAttributes();
+
 private:
+    ContextVertexArray* GetContextVertexArray(uint32_t slot);
+    void DeleteVertexArrays();
     void CalculateBounds(const std::vector<Vertex>& vertices);
     void SetupMesh(const std::vector<Vertex>& vertices,
         const std::vector<unsigned int>& indices);
@@ -0,0 +1,272 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../../common.h"
+#include "GL_render_targets.h"
+#include "../GL_state_cache.h"
+
+bool RenderTextureDesc::IsDepth() const {
+    switch (format) {
+    case GL_DEPTH_COMPONENT16:
+    case GL_DEPTH_COMPONENT24:
+    case GL_DEPTH_COMPONENT32F:
+    case GL_DEPTH24_STENCIL8:
+    case GL_DEPTH32F_STENCIL8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t RenderTextureDesc::GetSizeBytes() const {
+    size_t texelSize = 4;
+    switch (format) {
+    case GL_DEPTH_COMPONENT16:
+    case GL_R16F:
+        texelSize = 2;
+        break;
+    case GL_RGBA16F:
+    case GL_DEPTH32F_STENCIL8:
+        texelSize = 8;
+        break;
+    case GL_RGBA32F:
+        texelSize = 16;
+        break;
+    default:
+        break;
+    }
+    return static_cast<size_t>(width) * height * layers * texelSize;
+}
+
+RenderTargetPool::~RenderTargetPool() {
+    Cleanup();
+}
+
+unsigned int RenderTargetPool::CreateTexture(const RenderTextureDesc& desc) {
+    if (GraphicsBackend::IsHeadless()) {
+        return GraphicsBackend::Get()->CreateBuffer();
+    }
+
+    GLuint texture = 0;
+    glCreateTextures(desc.GetTarget(), 1, &texture);
+    if (texture == 0) return 0;
+
+    if (desc.array) {
+        glTextureStorage3D(texture, 1, desc.format, desc.width, desc.height, desc.layers);
+    }
+    else {
+        glTextureStorage2D(texture, 1, desc.format, desc.width, desc.height);
+    }
+
+    if (desc.IsDepth()) {
+        // Lookups outside a shadow map read as fully lit
+        float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        glTextureParameterfv(texture, GL_TEXTURE_BORDER_COLOR, borderColor);
+    }
+    else {
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    return texture;
+}
+
+unsigned int RenderTargetPool::Acquire(const RenderTextureDesc& desc) {
+    for (PooledTexture& pooled : _textures) {
+        if (pooled.inUse || !(pooled.desc == desc)) continue;
+        pooled.inUse = true;
+        pooled.lastUsedFrame = _frame;
+        return pooled.texture;
+    }
+
+    unsigned int texture = CreateTexture(desc);
+    if (texture == 0) {
+        spdlog::error("[RenderTargetPool::Acquire] Failed to create {}x{}x{} texture",
+            desc.width, desc.height, desc.layers);
+        return 0;
+    }
+
+    spdlog::debug("[RenderTargetPool] Created {}x{}x{} texture ({} KB)",
+        desc.width, desc.height, desc.layers, desc.GetSizeBytes() / 1024);
+
+    PooledTexture pooled;
+    pooled.desc = desc;
+    pooled.texture = texture;
+    pooled.inUse = true;
+    pooled.lastUsedFrame = _frame;
+    _textures.push_back(pooled);
+    return texture;
+}
+
+void RenderTargetPool::Release(unsigned int texture) {
+    for (PooledTexture& pooled : _textures) {
+        if (pooled.texture == texture) {
+            pooled.inUse = false;
+            return;
+        }
+    }
+}
+
+unsigned int RenderTargetPool::GetFramebuffer(const RenderAttachments& attachments) {
+    // A deleted texture leaves stale attachments behind and its name may
+    // come back for a different texture
+    if (GLStateCache::GetDeleteGeneration() != _deleteGeneration) {
+        DeleteFramebuffers();
+        _deleteGeneration = GLStateCache::GetDeleteGeneration();
+    }
+
+    CachedFramebuffer entry;
+    auto packAttachment = [&entry](size_t slot, const RenderAttachment& attachment) {
+        entry.key[slot * 2] = attachment.texture;
+        entry.key[slot * 2 + 1] = attachment.array ? attachment.layer + 1 : 0;
+    };
+    for (uint32_t i = 0; i < attachments.colorCount; ++i) packAttachment(i, attachments.colors[i]);
+    if (attachments.hasDepth) packAttachment(MAX_COLOR_ATTACHMENTS, attachments.depth);
+
+    for (const CachedFramebuffer& cached : _framebuffers) {
+        if (cached.key == entry.key) return cached.framebuffer;
+    }
+
+    glCreateFramebuffers(1, &entry.framebuffer);
+
+    auto attach = [&entry](GLenum point, const RenderAttachment& attachment) {
+        if (attachment.array) {
+            glNamedFramebufferTextureLayer(entry.framebuffer, point, attachment.texture, 0, attachment.layer);
+        }
+        else {
+            glNamedFramebufferTexture(entry.framebuffer, point, attachment.texture, 0);
+        }
+    };
+
+    std::array<GLenum, MAX_COLOR_ATTACHMENTS> drawBuffers{};
+    for (uint32_t i = 0; i < attachments.colorCount; ++i) {
+        attach(GL_COLOR_ATTACHMENT0 + i, attachments.colors[i]);
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    if (attachments.hasDepth) attach(GL_DEPTH_ATTACHMENT, attachments.depth);
+
+    if (attachments.colorCount > 0) {
+        glNamedFramebufferDrawBuffers(entry.framebuffer, static_cast<GLsizei>(attachments.colorCount), drawBuffers.data());
+    }
+    else {
+        glNamedFramebufferDrawBuffer(entry.framebuffer, GL_NONE);
+        glNamedFramebufferReadBuffer(entry.framebuffer, GL_NONE);
+    }
+
+    if (glCheckNamedFramebufferStatus(entry.framebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        spdlog::error("[RenderTargetPool::GetFramebuffer] Framebuffer is not complete");
+    }
+
+    _framebuffers.push_back(entry);
+    return entry.framebuffer;
+}
+
+void RenderTargetPool::BeginPass(const RenderAttachments& attachments) {
+    bool clears = attachments.hasDepth && attachments.depth.load == LoadOp::Clear;
+    for (uint32_t i = 0; i < attachments.colorCount; ++i) {
+        clears |= attachments.colors[i].load == LoadOp::Clear;
+    }
+
+    if (GraphicsBackend::IsHeadless()) {
+        IGraphicsBackend* backend = GraphicsBackend::Get();
+        backend->SetViewport(0, 0, static_cast<int>(attachments.width), static_cast<int>(attachments.height));
+        if (clears) backend->Clear(attachments.clearColor);
+        return;
+    }
+
+    GLuint framebuffer = attachments.backbuffer ? 0 : GetFramebuffer(attachments);
+
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    state.Viewport(0, 0, static_cast<GLsizei>(attachments.width), static_cast<GLsizei>(attachments.height));
+
+    if (!clears) return;
+
+    for (uint32_t i = 0; i < attachments.colorCount; ++i) {
+        if (attachments.colors[i].load != LoadOp::Clear) continue;
+        glClearNamedFramebufferfv(framebuffer, GL_COLOR, static_cast<GLint>(i), glm::value_ptr(attachments.clearColor));
+    }
+    if (attachments.hasDepth && attachments.depth.load == LoadOp::Clear) {
+        float depth = 1.0f;
+        glClearNamedFramebufferfv(framebuffer, GL_DEPTH, 0, &depth);
+    }
+}
+
+void RenderTargetPool::BindTexture(unsigned int texture, const RenderTextureDesc& desc, int textureUnit) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->BindTexture(texture, textureUnit);
+        return;
+    }
+    GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(textureUnit), desc.GetTarget(), texture);
+}
+
+void RenderTargetPool::EndFrame() {
+    ++_frame;
+
+    bool retired = false;
+    for (size_t i = 0; i < _textures.size();) {
+        PooledTexture& pooled = _textures[i];
+        if (pooled.inUse || _frame - pooled.lastUsedFrame < RETIRE_FRAMES) {
+            pooled.inUse = false;
+            ++i;
+            continue;
+        }
+
+        spdlog::debug("[RenderTargetPool] Retired {}x{}x{} texture",
+            pooled.desc.width, pooled.desc.height, pooled.desc.layers);
+
+        if (!GraphicsBackend::IsHeadless()) {
+            GLuint texture = pooled.texture;
+            glDeleteTextures(1, &texture);
+            retired = true;
+        }
+        _textures.erase(_textures.begin() + i);
+    }
+
+    if (retired) GLStateCache::OnObjectsDeleted();
+}
+
+void RenderTargetPool::DeleteFramebuffers() {
+    if (_framebuffers.empty()) return;
+
+    if (!GraphicsBackend::IsHeadless()) {
+        for (const CachedFramebuffer& cached : _framebuffers) {
+            GLuint framebuffer = cached.framebuffer;
+            glDeleteFramebuffers(1, &framebuffer);
+        }
+        GLStateCache::OnObjectsDeleted();
+    }
+    _framebuffers.clear();
+}
+
+void RenderTargetPool::Cleanup() {
+    DeleteFramebuffers();
+
+    if (!GraphicsBackend::IsHeadless()) {
+        for (const PooledTexture& pooled : _textures) {
+            GLuint texture = pooled.texture;
+            glDeleteTextures(1, &texture);
+        }
+        if (!_textures.empty()) GLStateCache::OnObjectsDeleted();
+    }
+    _textures.clear();
+}
+
+size_t RenderTargetPool::GetAllocatedBytes() const {
+    size_t bytes = 0;
+    for (const PooledTexture& pooled : _textures) bytes += pooled.desc.GetSizeBytes();
+    return bytes;
+}
@@ -0,0 +1,119 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef GL_RENDER_TARGETS_H
+#define GL_RENDER_TARGETS_H
+
+#include "../../../common.h"
+
+constexpr uint32_t MAX_COLOR_ATTACHMENTS = 4;
+
+struct RenderTextureDesc {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t layers = 1;
+    GLenum format = GL_RGBA8;
+    bool array = false;     // sampled as an array even with a single layer
+
+    bool operator==(const RenderTextureDesc&) const = default;
+
+    bool IsDepth() const;
+    GLenum GetTarget() const { return array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D; }
+    size_t GetSizeBytes() const;
+};
+
+enum class LoadOp : uint8_t {
+    Load,       // keep what the texture holds
+    Clear,
+    DontCare    // the pass overwrites every texel itself
+};
+
+struct RenderAttachment {
+    unsigned int texture = 0;
+    uint32_t layer = 0;     // only used for array textures
+    bool array = false;
+    LoadOp load = LoadOp::Load;
+};
+
+// Render targets of one pass. Texture 0 with backbuffer set is the default
+// framebuffer of the current context.
+struct RenderAttachments {
+    std::array<RenderAttachment, MAX_COLOR_ATTACHMENTS> colors{};
+    uint32_t colorCount = 0;
+    RenderAttachment depth;
+    bool hasDepth = false;
+    bool backbuffer = false;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    glm::vec4 clearColor{ 0.0f };
+};
+
+// Owns the textures behind transient render graph resources and the
+// framebuffers that attach them. Textures are handed out per description
+// and come back once their last pass ran, so resources whose lifetimes do
+// not overlap share one texture. GL has no placement of textures in a
+// shared heap, reusing whole textures is as close as it gets. Textures
+// nobody asked for in a while are deleted.
+class RenderTargetPool {
+public:
+    static constexpr uint64_t RETIRE_FRAMES = 120;
+
+    RenderTargetPool() = default;
+    ~RenderTargetPool();
+
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+    // Texture storage and sampling state every render target gets, also
+    // used for persistent targets outside the pool
+    static unsigned int CreateTexture(const RenderTextureDesc& desc);
+
+    // A texture matching desc that no other live resource holds
+    unsigned int Acquire(const RenderTextureDesc& desc);
+    void Release(unsigned int texture);
+
+    // Binds the framebuffer and viewport of a pass and applies its clears
+    void BeginPass(const RenderAttachments& attachments);
+
+    void BindTexture(unsigned int texture, const RenderTextureDesc& desc, int textureUnit);
+
+    // Deletes textures unused for RETIRE_FRAMES frames
+    void EndFrame();
+    void Cleanup();
+
+    size_t GetTextureCount() const { return _textures.size(); }
+    size_t GetAllocatedBytes() const;
+
+private:
+    struct PooledTexture {
+        RenderTextureDesc desc;
+        unsigned int texture = 0;
+        bool inUse = false;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    struct CachedFramebuffer {
+        std::array<uint32_t, (MAX_COLOR_ATTACHMENTS + 1) * 2> key{};
+        unsigned int framebuffer = 0;
+    };
+
+    std::vector<PooledTexture> _textures;
+    std::vector<CachedFramebuffer> _framebuffers;
+    uint64_t _frame = 0;
+    uint64_t _deleteGeneration = 0;
+
+    unsigned int GetFramebuffer(const RenderAttachments& attachments);
+    void DeleteFramebuffers();
+};
+
+#endif // GL_RENDER_TARGETS_H
@@ -11,6 +11,13 @@
 
 #include "../../../common.h"
 #include "GL_shader.h"
+#include "../GL_state_cache.h"
+#include "../../../core/telemetry.h"
+
+namespace {
+    // Program names handed out when there is no GL to create real ones
+    std::atomic<int> g_nextHeadlessProgram{ 1 };
+}
 
 // Shader implementation
 bool Shader::CheckErrors(unsigned int shader, const std::string& type) {
@@ -37,8 +44,9 @@ bool Shader::CheckErrors(unsigned int shader, const std::string& type) {
 }
 
 Shader::~Shader() {
-    if (_ID != -1) {
+    if (_ID != -1 && !GraphicsBackend::IsHeadless()) {
         glDeleteProgram(_ID);
+        GLStateCache::OnObjectsDeleted();
     }
 }
 
@@ -69,7 +77,10 @@ void Shader::LoadFromString(const std::string& vertexSource, const std::string&
     glLinkProgram(tempID);
 
     if (CheckErrors(tempID, "PROGRAM")) {
-        if (_ID != -1) glDeleteProgram(_ID);
+        if (_ID != -1) {
+            glDeleteProgram(_ID);
+            GLStateCache::OnObjectsDeleted();
+        }
         _uniformsLocations.clear();
         _ID = tempID;
     }
@@ -79,6 +90,12 @@ void Shader::LoadFromString(const std::string& vertexSource, const std::string&
 }
 
 void Shader::Load(const std::string& vertexPath, const std::string& fragmentPath) {
+    if (GraphicsBackend::IsHeadless()) {
+        _uniformsLocations.clear();
+        _ID = g_nextHeadlessProgram.fetch_add(1);
+        return;
+    }
+
     try {
         std::string vertexSource = Util::ReadTextFromFile("res/shaders/" + vertexPath);
         std::string fragmentSource = Util::ReadTextFromFile("res/shaders/" + fragmentPath);
@@ -90,7 +107,8 @@ void Shader::Load(const std::string& vertexPath, const std::string& fragmentPath
 }
 
 void Shader::Bind() const {
-    if (_ID != -1) glUseProgram(_ID);
+    if (_ID == -1) return;
+    GraphicsBackend::Get()->BindShader(_ID);
 }
 
 int Shader::GetUniformLocation(const std::string& name) {
@@ -108,44 +126,77 @@ int Shader::GetUniformLocation(const std::string& name) {
 }
 
 void Shader::SetMat4(const std::string& name, const glm::mat4& value) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->SetShaderMat4(_ID, name, value);
+        return;
+    }
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
     }
 }
 
 void Shader::SetVec3(const std::string& name, const glm::vec3& value) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->SetShaderVec3(_ID, name, value);
+        return;
+    }
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniform3fv(location, 1, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
     }
 }
 
 void Shader::SetVec4(const std::string& name, const glm::vec4& value) {
+    if (GraphicsBackend::IsHeadless()) return;
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniform4fv(location, 1, glm::value_ptr(value));
+        Telemetry::CountUniformUpload();
     }
 }
 
 void Shader::SetFloat(const std::string& name, float value) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->SetShaderFloat(_ID, name, value);
+        return;
+    }
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniform1f(location, value);
+        Telemetry::CountUniformUpload();
     }
 }
 
 void Shader::SetInt(const std::string& name, int value) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->SetShaderInt(_ID, name, value);
+        return;
+    }
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniform1i(location, value);
+        Telemetry::CountUniformUpload();
     }
 }
 
 void Shader::SetBool(const std::string& name, bool value) {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->SetShaderBool(_ID, name, value);
+        return;
+    }
+
     int location = GetUniformLocation(name);
     if (location != -1) {
         glUniform1i(location, (int)value);
+        Telemetry::CountUniformUpload();
     }
 }
 
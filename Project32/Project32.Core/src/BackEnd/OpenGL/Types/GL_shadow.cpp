@@ -11,9 +11,10 @@
 
 #include "../../../common.h"
 #include "GL_shadow.h"
+#include "../GL_state_cache.h"
 
-ShadowMap::ShadowMap(unsigned int width, unsigned int height)
-    : _shadowWidth(width), _shadowHeight(height),
+ShadowMap::ShadowMap(unsigned int width, unsigned int height, unsigned int layers)
+    : _shadowWidth(width), _shadowHeight(height), _layers(std::max(layers, 1u)),
       _lightSpaceMatrix(1.0f),
       _lightPos(0.0f, 0.0f, 0.0f)
 {
@@ -24,60 +25,65 @@ ShadowMap::~ShadowMap() {
 }
 
 bool ShadowMap::Initialize() {
-    glGenFramebuffers(1, &_depthMapFBO);
+    if (!_staticCache) {
+        spdlog::info("[ShadowMap] Initialized {}x{} with {} layers", _shadowWidth, _shadowHeight, _layers);
+        return true;
+    }
 
-    glGenTextures(1, &_depthMap);
-    glBindTexture(GL_TEXTURE_2D, _depthMap);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, _shadowWidth, _shadowHeight,
-        0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    _staticDepthMap = RenderTargetPool::CreateTexture(GetDesc());
+    if (_staticDepthMap == 0) {
+        spdlog::error("[ShadowMap] Failed to create static cache {}x{}x{}", _shadowWidth, _shadowHeight, _layers);
+        return false;
+    }
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+    spdlog::info("[ShadowMap] Initialized {}x{} with {} layers, static cache", _shadowWidth, _shadowHeight, _layers);
+    return true;
+}
 
-    float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
+RenderTextureDesc ShadowMap::GetDesc() const {
+    RenderTextureDesc desc;
+    desc.width = _shadowWidth;
+    desc.height = _shadowHeight;
+    desc.layers = _layers;
+    desc.format = GL_DEPTH_COMPONENT32F;
+    desc.array = true;
+    return desc;
+}
 
-    glBindFramebuffer(GL_FRAMEBUFFER, _depthMapFBO);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, _depthMap, 0);
+bool ShadowMap::SetLayerCount(unsigned int layers) {
+    layers = std::max(layers, 1u);
+    if (layers == _layers) return true;
 
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
+    Cleanup();
+    _layers = layers;
+    return Initialize();
+}
 
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        spdlog::error("[ShadowMap] Framebuffer is not complete!");
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        return false;
-    }
+bool ShadowMap::SetStaticCacheEnabled(bool enabled) {
+    if (enabled == _staticCache) return true;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    spdlog::info("[ShadowMap] Initialized {}x{}", _shadowWidth, _shadowHeight);
-    return true;
+    Cleanup();
+    _staticCache = enabled;
+    return Initialize();
 }
 
 void ShadowMap::Cleanup() {
-    if (_depthMap != 0) {
-        glDeleteTextures(1, &_depthMap);
-        _depthMap = 0;
-    }
-    if (_depthMapFBO != 0) {
-        glDeleteFramebuffers(1, &_depthMapFBO);
-        _depthMapFBO = 0;
+    if (_staticDepthMap == 0) return;
+
+    if (!GraphicsBackend::IsHeadless()) {
+        glDeleteTextures(1, &_staticDepthMap);
+        GLStateCache::OnObjectsDeleted();
     }
+    _staticDepthMap = 0;
 }
 
-void ShadowMap::BeginShadowPass() {
-    glViewport(0, 0, _shadowWidth, _shadowHeight);
-    glBindFramebuffer(GL_FRAMEBUFFER, _depthMapFBO);
-    glClear(GL_DEPTH_BUFFER_BIT);
-
-    glCullFace(GL_FRONT);
-}
+void ShadowMap::CopyStaticLayer(unsigned int depthMap, unsigned int layer) const {
+    if (GraphicsBackend::IsHeadless() || _staticDepthMap == 0 || depthMap == 0) return;
 
-void ShadowMap::EndShadowPass() {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glCullFace(GL_BACK);
+    layer = std::min(layer, _layers - 1);
+    glCopyImageSubData(_staticDepthMap, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+        depthMap, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+        _shadowWidth, _shadowHeight, 1);
 }
 
 void ShadowMap::UpdateLightSpaceMatrix(const glm::vec3& lightPos, const glm::vec3& lookAt) {
@@ -90,8 +96,3 @@ void ShadowMap::UpdateLightSpaceMatrix(const glm::vec3& lightPos, const glm::vec
 
     _lightSpaceMatrix = lightProjection * lightView;
 }
-
-void ShadowMap::BindForReading(int textureUnit) {
-    glActiveTexture(GL_TEXTURE0 + textureUnit);
-    glBindTexture(GL_TEXTURE_2D, _depthMap);
-}
\ No newline at end of file
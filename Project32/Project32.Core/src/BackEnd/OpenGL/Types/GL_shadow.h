@@ -15,33 +15,50 @@
 #define GL_SHADOW_H 
 
 #include "../../../common.h"
+#include "GL_render_targets.h"
 
+// Size and light matrix of the shadow map, one depth layer per shadow
+// cascade and a single layer when cascades are off. The depth array drawn
+// each frame is a transient render graph texture described by GetDesc().
+// With the static cache enabled a persistent array of the same shape keeps
+// the depth of static casters, each frame's layers start from a copy of it
+// so only dynamic casters are drawn.
 class ShadowMap {
 private:
-    unsigned int _depthMapFBO = 0;
-    unsigned int _depthMap = 0;
+    unsigned int _staticDepthMap = 0;
+    bool _staticCache = false;
     unsigned int _shadowWidth = 2048;
     unsigned int _shadowHeight = 2048;
+    unsigned int _layers = 1;
 
     glm::mat4 _lightSpaceMatrix;
     glm::vec3 _lightPos;
 
+
 public:
-    ShadowMap(unsigned int width = 2048, unsigned int height = 2048);
+    ShadowMap(unsigned int width = 2048, unsigned int height = 2048, unsigned int layers = 1);
     ~ShadowMap();
 
     bool Initialize();
     void Cleanup();
 
-    void BeginShadowPass();
-    void EndShadowPass();
+    // Reallocates the static cache when the count changes
+    bool SetLayerCount(unsigned int layers);
+    bool SetStaticCacheEnabled(bool enabled);
+
+    RenderTextureDesc GetDesc() const;
 
-    unsigned int GetDepthMap() const { return _depthMap; }
+    // Copies one layer of the static cache into the same layer of depthMap,
+    // a texture matching GetDesc()
+    void CopyStaticLayer(unsigned int depthMap, unsigned int layer) const;
+
+    unsigned int GetStaticDepthMap() const { return _staticDepthMap; }
+    unsigned int GetLayerCount() const { return _layers; }
+    bool IsStaticCacheEnabled() const { return _staticCache; }
+    unsigned int GetWidth() const { return _shadowWidth; }
     glm::mat4 GetLightSpaceMatrix() const { return _lightSpaceMatrix; }
 
     void UpdateLightSpaceMatrix(const glm::vec3& lightPos, const glm::vec3& lookAt = glm::vec3(0.0f));
-
-    void BindForReading(int textureUnit = 1);
 };
 
 #endif // GL_SHADOW_H
\ No newline at end of file
@@ -11,11 +11,13 @@
 
 #include "../../../common.h"
 #include "GL_skybox.h"
+#include "../GL_state_cache.h"
 
 Skybox::~Skybox() {
     if (_VAO) glDeleteVertexArrays(1, &_VAO);
     if (_VBO) glDeleteBuffers(1, &_VBO);
     if (_textureID) glDeleteTextures(1, &_textureID);
+    if (_VAO || _VBO || _textureID) GLStateCache::OnObjectsDeleted();
 }
 
 void Skybox::CreateCube() {
@@ -66,20 +68,19 @@ void Skybox::CreateCube() {
     glGenVertexArrays(1, &_VAO);
     glGenBuffers(1, &_VBO);
 
-    glBindVertexArray(_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, _VBO);
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindVertexArray(_VAO);
+    state.BindBuffer(GL_ARRAY_BUFFER, _VBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(skyboxVertices), &skyboxVertices, GL_STATIC_DRAW);
 
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-
-    glBindVertexArray(0);
 }
 
 unsigned int Skybox::LoadCubemap(const std::vector<std::string>& faces) {
     unsigned int textureID;
     glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+    GLStateCache::GetCurrent().BindTexture(0, GL_TEXTURE_CUBE_MAP, textureID);
 
     int width, height, nrChannels;
     for (unsigned int i = 0; i < faces.size(); i++)
@@ -114,12 +115,11 @@ void Skybox::Load(const std::vector<std::string>& faces) {
 
 void Skybox::Draw() const {
     if (_VAO && _textureID) {
-        glDepthFunc(GL_LEQUAL);
-        glBindVertexArray(_VAO);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, _textureID);
+        GLStateCache& state = GLStateCache::GetCurrent();
+        state.DepthFunc(GL_LEQUAL);
+        state.BindVertexArray(_VAO);
+        state.BindTexture(0, GL_TEXTURE_CUBE_MAP, _textureID);
         glDrawArrays(GL_TRIANGLES, 0, 36);
-        glBindVertexArray(0);
-        glDepthFunc(GL_LESS);
+        state.DepthFunc(GL_LESS);
     }
 }
\ No newline at end of file
@@ -0,0 +1,266 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../../common.h"
+#include "GL_stream_buffer.h"
+#include "../GL_state_cache.h"
+#include "../../../core/telemetry.h"
+
+static void DeleteGLBuffer(unsigned int bufferID, bool mapped) {
+    if (bufferID == 0) return;
+
+    GLuint buffer = bufferID;
+    if (mapped) {
+        GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    glDeleteBuffers(1, &buffer);
+    GLStateCache::OnObjectsDeleted();
+}
+
+StreamBuffer::StreamBuffer(size_t regionSize, uint32_t regionCount)
+    : _regionSize(regionSize)
+    , _regionCount(glm::clamp<uint32_t>(regionCount, 1, MAX_REGIONS))
+{
+}
+
+StreamBuffer::~StreamBuffer() {
+    Cleanup();
+}
+
+bool StreamBuffer::Initialize() {
+    if (_regionSize == 0) {
+        spdlog::error("[StreamBuffer::Initialize] Region size must not be zero");
+        return false;
+    }
+
+    if (!CreateStorage()) return false;
+
+    spdlog::info("[StreamBuffer::Initialize] {} x {} KB regions, {}", _regionCount, _regionSize / 1024,
+        GraphicsBackend::IsHeadless() ? "headless" : _persistent ? "persistently mapped" : "orphaning fallback");
+    return true;
+}
+
+void StreamBuffer::Cleanup() {
+    ReleaseStorage();
+    _head = 0;
+    _flushed = 0;
+    _inFrame = false;
+}
+
+bool StreamBuffer::CreateStorage() {
+    size_t totalSize = _regionSize * _regionCount;
+    _persistent = false;
+    _mapped = nullptr;
+
+    if (GraphicsBackend::IsHeadless()) {
+        _buffer = GraphicsBackend::Get()->CreateBuffer();
+        _staging.assign(totalSize, 0);
+        return true;
+    }
+
+    if (GLAD_GL_VERSION_4_4) {
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferStorage(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(totalSize), nullptr, flags);
+        void* mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, static_cast<GLsizeiptr>(totalSize), flags);
+
+        if (mapped) {
+            _buffer = buffer;
+            _mapped = static_cast<uint8_t*>(mapped);
+            _persistent = true;
+            _staging.clear();
+            return true;
+        }
+
+        spdlog::warn("[StreamBuffer::CreateStorage] Persistent mapping failed, using the orphaning path");
+        glDeleteBuffers(1, &buffer);
+        GLStateCache::OnObjectsDeleted();
+    }
+
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    if (buffer == 0) {
+        spdlog::error("[StreamBuffer::CreateStorage] Failed to create buffer");
+        return false;
+    }
+
+    GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(totalSize), nullptr, GL_STREAM_DRAW);
+
+    _buffer = buffer;
+    _staging.assign(totalSize, 0);
+    return true;
+}
+
+void StreamBuffer::ReleaseStorage() {
+    if (!GraphicsBackend::IsHeadless()) {
+        for (GLsync& fence : _fences) {
+            if (fence) {
+                glDeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+
+        DeleteGLBuffer(_buffer, _mapped != nullptr);
+    }
+    else if (_buffer != 0 && GraphicsBackend::Get()) {
+        GraphicsBackend::Get()->DeleteBuffer(_buffer);
+    }
+
+    _buffer = 0;
+    _mapped = nullptr;
+    _persistent = false;
+    _staging.clear();
+    _fences = {};
+}
+
+bool StreamBuffer::Reserve(size_t regionSize) {
+    if (regionSize <= _regionSize) return true;
+
+    if (_inFrame) {
+        spdlog::error("[StreamBuffer::Reserve] Cannot grow while a frame is being written");
+        return false;
+    }
+
+    for (uint32_t region = 0; region < _regionCount; ++region) {
+        WaitForRegion(region);
+    }
+
+    size_t newSize = _regionSize;
+    while (newSize < regionSize) newSize *= 2;
+
+    // The new buffer is created before the old one is deleted so it never
+    // reuses the old name, VAOs compare names to decide whether to re-attach
+    unsigned int oldBuffer = _buffer;
+    uint8_t* oldMapped = _mapped;
+    bool oldPersistent = _persistent;
+    size_t oldRegionSize = _regionSize;
+    bool headless = GraphicsBackend::IsHeadless();
+
+    _regionSize = newSize;
+    if (!CreateStorage()) {
+        // Keep streaming through the old buffer at its old size
+        _regionSize = oldRegionSize;
+        _mapped = oldMapped;
+        _persistent = oldPersistent;
+        return false;
+    }
+    _region = 0;
+
+    if (headless) {
+        GraphicsBackend::Get()->DeleteBuffer(oldBuffer);
+    }
+    else {
+        DeleteGLBuffer(oldBuffer, oldMapped != nullptr);
+    }
+
+    spdlog::info("[StreamBuffer::Reserve] Grew regions to {} KB", _regionSize / 1024);
+    return true;
+}
+
+void StreamBuffer::WaitForRegion(uint32_t region) {
+    GLsync& fence = _fences[region];
+    if (!fence) return;
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        ++_stalls;
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+
+    if (result == GL_WAIT_FAILED) {
+        spdlog::error("[StreamBuffer::WaitForRegion] Wait on region {} failed", region);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void StreamBuffer::BeginFrame() {
+    if (_buffer == 0) return;
+
+    _region = (_region + 1) % _regionCount;
+    _head = 0;
+    _flushed = 0;
+    _inFrame = true;
+
+    if (GraphicsBackend::IsHeadless()) return;
+
+    if (_persistent) {
+        WaitForRegion(_region);
+    }
+    else {
+        // Orphaning hands the old storage to the driver, draws still in
+        // flight keep reading it while this frame writes fresh memory
+        GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, _buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(_regionSize * _regionCount), nullptr, GL_STREAM_DRAW);
+    }
+}
+
+StreamAllocation StreamBuffer::Allocate(size_t size, size_t alignment) {
+    if (!_inFrame || size == 0) return {};
+
+    alignment = std::max<size_t>(alignment, 1);
+
+    size_t regionOffset = GetRegionOffset();
+    size_t offset = (regionOffset + _head + alignment - 1) / alignment * alignment;
+    size_t end = offset + size - regionOffset;
+
+    if (end > _regionSize) {
+        spdlog::error("[StreamBuffer::Allocate] {} bytes do not fit, {} of {} bytes used",
+            size, _head, _regionSize);
+        return {};
+    }
+
+    _head = end;
+
+    StreamAllocation allocation;
+    allocation.data = GetWritePointer() + offset;
+    allocation.offset = offset;
+    allocation.size = size;
+    return allocation;
+}
+
+void StreamBuffer::Flush() {
+    if (!_inFrame || _head == _flushed) return;
+
+    size_t offset = GetRegionOffset() + _flushed;
+    size_t size = _head - _flushed;
+    _flushed = _head;
+
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->UpdateBufferSubData(_buffer, _staging.data() + offset, size, offset);
+        return;
+    }
+
+    // Coherent mapping makes the writes visible without a call
+    if (!_persistent) {
+        GLStateCache::GetCurrent().BindBuffer(GL_COPY_WRITE_BUFFER, _buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), _staging.data() + offset);
+    }
+
+    Telemetry::CountBufferUpload(size);
+}
+
+void StreamBuffer::EndFrame() {
+    if (!_inFrame) return;
+    _inFrame = false;
+
+    if (_persistent) {
+        _fences[_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef GL_STREAM_BUFFER_H
+#define GL_STREAM_BUFFER_H
+
+#include "../../../common.h"
+
+// Memory handed out by StreamBuffer::Allocate, writable until the next Flush.
+// 'offset' is the byte offset into the buffer the GPU reads from.
+struct StreamAllocation {
+    void* data = nullptr;
+    size_t offset = 0;
+    size_t size = 0;
+
+    bool IsValid() const { return data != nullptr; }
+};
+
+// Ring of per-frame regions for data rewritten every frame. Each frame
+// suballocates from its own region, the region is fenced at EndFrame and
+// only reused once the GPU passed the fence, so writes never wait on the
+// driver. Uses a persistently mapped glBufferStorage buffer on GL 4.4+ and
+// falls back to orphaning with glBufferData plus glBufferSubData uploads.
+class StreamBuffer {
+public:
+    static constexpr uint32_t MAX_REGIONS = 4;
+
+    explicit StreamBuffer(size_t regionSize, uint32_t regionCount = 3);
+    ~StreamBuffer();
+
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    bool Initialize();
+    void Cleanup();
+
+    // Grows every region to at least regionSize, waits for the GPU to finish
+    // with the old buffer. Only valid outside BeginFrame/EndFrame.
+    bool Reserve(size_t regionSize);
+
+    // Moves to the next region, blocking only if the GPU still reads it
+    void BeginFrame();
+
+    // 'alignment' may be any size, e.g. the vertex stride so the offset
+    // converts to a base instance. Fails when the region is full.
+    StreamAllocation Allocate(size_t size, size_t alignment = 16);
+
+    // Makes everything allocated since the last flush visible to the GPU,
+    // call before the draws that read it
+    void Flush();
+
+    // Fences the region, call after the last draw that reads it
+    void EndFrame();
+
+    unsigned int GetBuffer() const { return _buffer; }
+    size_t GetRegionSize() const { return _regionSize; }
+    size_t GetUsedBytes() const { return _head; }
+    bool IsPersistent() const { return _persistent; }
+
+    // Frames that had to wait for the GPU before reusing a region
+    uint64_t GetStallCount() const { return _stalls; }
+
+private:
+    unsigned int _buffer = 0;
+    size_t _regionSize = 0;
+    uint32_t _regionCount = 3;
+    uint32_t _region = 0;
+
+    size_t _head = 0;
+    size_t _flushed = 0;
+    bool _inFrame = false;
+
+    bool _persistent = false;
+    uint8_t* _mapped = nullptr;
+    std::vector<uint8_t> _staging;
+    std::array<GLsync, MAX_REGIONS> _fences{};
+
+    uint64_t _stalls = 0;
+
+    bool CreateStorage();
+    void ReleaseStorage();
+    void WaitForRegion(uint32_t region);
+    size_t GetRegionOffset() const { return static_cast<size_t>(_region) * _regionSize; }
+    uint8_t* GetWritePointer() { return _mapped ? _mapped : _staging.data(); }
+};
+
+#endif // GL_STREAM_BUFFER_H
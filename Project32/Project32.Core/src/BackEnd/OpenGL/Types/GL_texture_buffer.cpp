@@ -0,0 +1,100 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../../../common.h"
+#include "GL_texture_buffer.h"
+#include "../GL_state_cache.h"
+#include "../../../core/telemetry.h"
+
+TextureBuffer::TextureBuffer(GLenum format)
+    : _format(format)
+{
+}
+
+TextureBuffer::~TextureBuffer() {
+    Cleanup();
+}
+
+bool TextureBuffer::Initialize(size_t capacity) {
+    _capacity = std::max<size_t>(capacity, 16);
+    _size = 0;
+
+    if (GraphicsBackend::IsHeadless()) {
+        _buffer = GraphicsBackend::Get()->CreateBuffer();
+        _texture = _buffer;
+        return _buffer != 0;
+    }
+
+    glGenBuffers(1, &_buffer);
+    glGenTextures(1, &_texture);
+    if (_buffer == 0 || _texture == 0) {
+        spdlog::error("[TextureBuffer::Initialize] Failed to create buffer texture");
+        Cleanup();
+        return false;
+    }
+
+    GLStateCache& state = GLStateCache::GetCurrent();
+    state.BindBuffer(GL_TEXTURE_BUFFER, _buffer);
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(_capacity), nullptr, GL_STREAM_DRAW);
+
+    // The texel count follows the buffer size, growing needs no re-attach
+    state.BindTexture(0, GL_TEXTURE_BUFFER, _texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, _format, _buffer);
+    return true;
+}
+
+void TextureBuffer::Cleanup() {
+    if (GraphicsBackend::IsHeadless()) {
+        if (_buffer != 0 && GraphicsBackend::Get()) GraphicsBackend::Get()->DeleteBuffer(_buffer);
+    }
+    else {
+        if (_texture != 0) glDeleteTextures(1, &_texture);
+        if (_buffer != 0) glDeleteBuffers(1, &_buffer);
+        if (_texture != 0 || _buffer != 0) GLStateCache::OnObjectsDeleted();
+    }
+
+    _buffer = 0;
+    _texture = 0;
+    _capacity = 0;
+    _size = 0;
+}
+
+bool TextureBuffer::Upload(const void* data, size_t size) {
+    if (_buffer == 0) return false;
+    _size = size;
+    if (size == 0) return true;
+
+    if (size > _capacity) {
+        _capacity = std::max(size, _capacity * 2);
+        spdlog::debug("[TextureBuffer::Upload] Grew to {} KB", _capacity / 1024);
+    }
+
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->UpdateBufferSubData(_buffer, data, size, 0);
+        return true;
+    }
+
+    GLStateCache::GetCurrent().BindBuffer(GL_TEXTURE_BUFFER, _buffer);
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(_capacity), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, static_cast<GLsizeiptr>(size), data);
+
+    Telemetry::CountBufferUpload(size);
+    return true;
+}
+
+void TextureBuffer::Bind(int textureUnit) const {
+    if (GraphicsBackend::IsHeadless()) {
+        GraphicsBackend::Get()->BindTexture(_texture, textureUnit);
+        return;
+    }
+
+    GLStateCache::GetCurrent().BindTexture(static_cast<GLuint>(textureUnit), GL_TEXTURE_BUFFER, _texture);
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef GL_TEXTURE_BUFFER_H
+#define GL_TEXTURE_BUFFER_H
+
+#include "../../../common.h"
+
+// Buffer texture (samplerBuffer / usamplerBuffer in GLSL) refilled from the
+// CPU. Each upload orphans the storage, so a frame still reading the old
+// contents on the GPU never stalls the write, and grows it when the data
+// does not fit. Texel format is fixed at construction.
+class TextureBuffer {
+private:
+    unsigned int _buffer = 0;
+    unsigned int _texture = 0;
+    GLenum _format;
+    size_t _capacity = 0;
+    size_t _size = 0;
+
+public:
+    explicit TextureBuffer(GLenum format);
+    ~TextureBuffer();
+
+    TextureBuffer(const TextureBuffer&) = delete;
+    TextureBuffer& operator=(const TextureBuffer&) = delete;
+
+    bool Initialize(size_t capacity);
+    void Cleanup();
+
+    bool Upload(const void* data, size_t size);
+
+    template<typename T>
+    bool Upload(const std::vector<T>& data) {
+        return Upload(data.data(), data.size() * sizeof(T));
+    }
+
+    void Bind(int textureUnit) const;
+
+    unsigned int GetTexture() const { return _texture; }
+    size_t GetCapacity() const { return _capacity; }
+    size_t GetSize() const { return _size; }
+};
+
+#endif // GL_TEXTURE_BUFFER_H
@@ -14,20 +14,25 @@
 
  // Texture functions
 void Texture::Bind(GLenum textureUnit) const {
-    glActiveTexture(textureUnit);
-    glBindTexture(GL_TEXTURE_2D, _textureID);
+    GraphicsBackend::Get()->BindTexture(_textureID, static_cast<int>(textureUnit - GL_TEXTURE0));
 }
 
 bool Texture::LoadFromFile(const std::string& textureName, const std::string& filepath, bool flipVertically) {
     _name = textureName;
     _filepath = filepath;
 
+    if (GraphicsBackend::IsHeadless()) {
+        // Nothing to upload to, only read the header so sizes are still real
+        return stbi_info(filepath.c_str(), &_width, &_height, &_channels) != 0;
+    }
+
     if (_textureID != 0) {
         glDeleteTextures(1, &_textureID);
+        GLStateCache::OnObjectsDeleted();
         _textureID = 0;
     }
     glGenTextures(1, &_textureID);
-    glBindTexture(GL_TEXTURE_2D, _textureID);
+    GLStateCache::GetCurrent().BindTexture(0, GL_TEXTURE_2D, _textureID);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
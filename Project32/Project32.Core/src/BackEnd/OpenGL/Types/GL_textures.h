@@ -13,6 +13,7 @@
 #define TEXTURE_H
 
 #include "../../../common.h"
+#include "../GL_state_cache.h"
 
 class Texture {
 private:
@@ -27,6 +28,7 @@ public:
     ~Texture() {
         if (_textureID != 0) {
             glDeleteTextures(1, &_textureID);
+            GLStateCache::OnObjectsDeleted();
         }
     }
 
@@ -43,6 +45,7 @@ public:
         if (this != &other) {
             if (_textureID != 0) {
                 glDeleteTextures(1, &_textureID);
+                GLStateCache::OnObjectsDeleted();
             }
             _textureID = other._textureID;
             _width = other._width;
@@ -1,5 +1,6 @@
 ﻿#include "../common.h"
 #include "OpenGL/GL_backEnd.h"
+#include "Null/Null_backEnd.h"
 #include "backend.h"
 
 /*
@@ -37,6 +38,10 @@ bool GraphicsBackend::Initialize(BackendType type) {
             s_instance = std::make_unique<OpenGLBackend>();
             break;
 
+        case BackendType::Null:
+            s_instance = std::make_unique<NullBackend>();
+            break;
+
         case BackendType::VULKAN:
             spdlog::warn("[GraphicsBackend] Vulkan not implemented yet!");
             return false;
@@ -11,7 +11,8 @@ enum class BackendType {
     OPENGL,
     VULKAN,
     DX11,
-    DX12
+    DX12,
+    Null    // Headless, no GPU or window. Not NULL, that one is a macro.
 };
 
 class IGraphicsBackend {
@@ -42,16 +43,36 @@ public:
     virtual void SetShaderInt(int shaderID, const std::string& name, int value) = 0;
     virtual void SetShaderBool(int shaderID, const std::string& name, bool value) = 0;
 
+    // Location based setters act on the bound shader, used when replaying command buffers
+    virtual int GetUniformLocation(int shaderID, const std::string& name) = 0;
+    virtual void SetUniformMat4(int location, const glm::mat4& value) = 0;
+    virtual void SetUniformVec3(int location, const glm::vec3& value) = 0;
+    virtual void SetUniformFloat(int location, float value) = 0;
+    virtual void SetUniformInt(int location, int value) = 0;
+
     virtual void BindTexture(unsigned int textureID, int slot = 0) = 0;
     virtual void UnbindTexture(int slot = 0) = 0;
 
     virtual void DrawIndexed(unsigned int vao, unsigned int indexCount) = 0;
     virtual void DrawArrays(unsigned int vao, unsigned int vertexCount) = 0;
+    // baseInstance offsets per-instance attributes, not gl_InstanceID
+    virtual void DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance = 0) = 0;
+    virtual void DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance = 0) = 0;
+    // Draws 'drawCount' IndirectDrawCommands starting at 'offset' bytes into
+    // the buffer. triangleCount only feeds telemetry, the GPU reads the counts.
+    virtual void MultiDrawIndexedIndirect(unsigned int vao, unsigned int indirectBuffer, size_t offset, unsigned int drawCount, uint64_t triangleCount) = 0;
 
     virtual unsigned int CreateBuffer() = 0;
     virtual void DeleteBuffer(unsigned int bufferID) = 0;
     virtual unsigned int CreateVertexArray() = 0;
     virtual void DeleteVertexArray(unsigned int vaoID) = 0;
+    virtual void UploadBufferData(unsigned int bufferID, const void* data, size_t size) = 0;
+
+    // Fixed size storage for uniform blocks, rewritten in place and bound to
+    // an indexed binding point
+    virtual unsigned int CreateUniformBuffer(size_t size) = 0;
+    virtual void UpdateBufferSubData(unsigned int bufferID, const void* data, size_t size, size_t offset = 0) = 0;
+    virtual void BindUniformBuffer(unsigned int bufferID, unsigned int binding) = 0;
 
     virtual std::string GetAPIVersion() const = 0;
     virtual std::string GetRendererName() const = 0;
@@ -61,6 +82,7 @@ class GraphicsBackend {
 public:
     static IGraphicsBackend* Get();
     static BackendType GetCurrentType();
+    static bool IsHeadless() { return s_currentType == BackendType::Null; }
     static bool Initialize(BackendType type);
     static void Destroy();
 
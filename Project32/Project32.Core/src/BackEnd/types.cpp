@@ -44,6 +44,7 @@ namespace MeshFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return StaticMeshes::GetQuad();
 
         case BackendType::VULKAN:
@@ -69,6 +70,7 @@ namespace MeshFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return StaticMeshes::GetCube();
 
         case BackendType::VULKAN:
@@ -94,6 +96,7 @@ namespace MeshFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return StaticMeshes::GetCylinder(segments, height, radius);
 
         case BackendType::VULKAN:
@@ -120,6 +123,7 @@ namespace MeshFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return StaticMeshes::GetSphere(latitudeSegments, longitudeSegments, radius);
 
         case BackendType::VULKAN:
@@ -145,6 +149,7 @@ namespace MeshFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return StaticMeshes::GetCapsule(segments, rings, height, radius);
 
         case BackendType::VULKAN:
@@ -175,6 +180,7 @@ namespace ShaderFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return std::make_unique<Shader>();
 
         case BackendType::VULKAN:
@@ -200,6 +206,7 @@ namespace ShaderFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return std::make_unique<ShaderManager>();
 
         case BackendType::VULKAN:
@@ -227,6 +234,7 @@ namespace TextureFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return std::make_unique<Texture>(name);
 
         case BackendType::VULKAN:
@@ -252,6 +260,7 @@ namespace TextureFactory {
 
         switch (backend) {
         case BackendType::OPENGL:
+        case BackendType::Null:
             return std::make_unique<TextureManager>();
 
         case BackendType::VULKAN:
@@ -281,6 +290,10 @@ namespace SkyboxFactory {
         case BackendType::OPENGL:
             return std::make_unique<Skybox>();
 
+        case BackendType::Null:
+            spdlog::info("[SkyboxFactory] Null backend has no skybox");
+            return nullptr;
+
         case BackendType::VULKAN:
 			spdlog::error("[SkyboxFactory] Vulkan not implemented yet!");
             return nullptr;
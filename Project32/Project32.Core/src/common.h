@@ -47,6 +47,7 @@
 #include <chrono>
 #include <filesystem>
 #include <algorithm>
+#include <numeric>
 #include <iomanip>
 #include <functional>
 #include <format>
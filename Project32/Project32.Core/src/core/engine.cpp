@@ -16,52 +16,8 @@
 #include "../core/window.h"
 #include "../modules/ModuleManager.h"
 
-ThreadPool::ThreadPool(size_t threads) {
-    for (size_t i = 0; i < threads; ++i) {
-        _workers.emplace_back([this] {
-            while (true) {
-                std::function<void()> task;
-                {
-                    std::unique_lock<std::mutex> lock(_queueMutex);
-                    _condition.wait(lock, [this] {
-                        return _stop.load() || !_tasks.empty();
-                        });
-
-                    if (_stop.load() && _tasks.empty()) {
-                        return;
-                    }
-
-                    if (!_tasks.empty()) {
-                        task = std::move(_tasks.front());
-                        _tasks.pop();
-                    }
-                }
-
-                if (task) {
-                    task();
-                }
-            }
-            });
-    }
-    spdlog::info("[ThreadPool] Created with {} worker threads", threads);
-}
-
-ThreadPool::~ThreadPool() {
-    _stop.store(true);
-    _condition.notify_all();
-
-    for (std::thread& worker : _workers) {
-        if (worker.joinable()) {
-            worker.join();
-        }
-    }
-    spdlog::info("[ThreadPool] Destroyed");
-}
-
-void ThreadPool::Wait() {
-    std::unique_lock<std::mutex> lock(_queueMutex);
-    _condition.wait(lock, [this] { return _tasks.empty(); });
-}
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
 
 int Engine::s_nextID = 0;
 std::unique_ptr<EngineManager> EngineManager::s_instance = nullptr;
@@ -100,6 +56,7 @@ void Engine::Init() {
 		_windowManager = std::make_unique<WindowManager>(this);
         size_t threadCount = std::max(2u, std::thread::hardware_concurrency() - 2);
         _threadPool = std::make_unique<ThreadPool>(threadCount);
+        BuildUpdateGraph();
 
         if (_windowManager->Count() == 0) {
             spdlog::warn("[Engine::Init] No windows in window manager for engine {}", _ID);
@@ -174,7 +131,7 @@ void Engine::Init() {
             local floor = GetScript(1)
             if floor then
                 floor.position = Vec3.new(0.0, 0.0, 0.0)
-                floor.size = Vec3.new(20.0, 0.1, 20.0)
+                floor.scale = Vec3.new(20.0, 0.1, 20.0)
                 floor.color = Vec3.new(0.3, 0.3, 0.3)
                 Log("Floor initialized")
             else
@@ -186,7 +143,7 @@ void Engine::Init() {
             local cube = GetScript(2)
             if cube then
                 cube.position = Vec3.new(0.0, 1.5, 0.0)
-                cube.size = Vec3.new(1.0, 1.0, 1.0)
+                cube.scale = Vec3.new(1.0, 1.0, 1.0)
                 cube.rotation = Vec3.new(0.0, 0.0, 0.0)
                 cube.rotationSpeed = 45.0
                 cube.color = Vec3.new(1.0, 0.5, 0.2)
@@ -221,7 +178,10 @@ void Engine::StopUpdateThread() {
     isRunning.store(false);
 
     if (_updateThread && _updateThread->joinable()) {
-        _frameCV.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(_pacingMutex);
+        }
+        _pacingCV.notify_all();
         _updateThread->join();
         _updateThread.reset();
         spdlog::info("[Engine::StopUpdateThread] Stopped update thread for engine {}", _ID);
@@ -237,30 +197,134 @@ void Engine::UpdateLoop() {
         float dt = timer.GetDeltaTime();
         _deltaTime.store(dt);
 
-        {
-            std::unique_lock<std::mutex> lock(_dataMutex);
-            _frameCV.wait(lock, [this] { return _renderComplete.load() || !isRunning.load(); });
+        // Pacing keeps the renderer at most one frame behind, so the buffer
+        // recycled here is no longer being read
+        _frameAllocator.BeginFrame();
 
-            if (!isRunning.load()) break;
-        }
+        SystemFrameContext context;
+        context.deltaTime = dt;
+        context.frameIndex = _publishedFrame.load() + 1;
 
-        if (!isPaused.load()) {
-            Update(dt);
-        }
-
-        {
-            std::lock_guard<std::mutex> lock(_dataMutex);
-            _frameReady.store(true);
-            _renderComplete.store(false);
-        }
-        _frameCV.notify_all();
+        _scriptMs = 0.0f;
+        auto updateStart = std::chrono::steady_clock::now();
+        _updateGraph->Execute(_threadPool.get(), context);
+        float updateMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+        _telemetry.SetUpdateTimes(updateMs, _scriptMs);
 
+        PublishSnapshot();
         _frameCount.fetch_add(1);
+
+        // Overlap with the frame being rendered, but do not run further ahead
+        std::unique_lock<std::mutex> lock(_pacingMutex);
+        _pacingCV.wait(lock, [this] {
+            return _consumedFrame.load() >= _publishedFrame.load() || !isRunning.load();
+            });
     }
 
     spdlog::info("[Engine::UpdateLoop] Update thread exited for engine {}", _ID);
 }
 
+void Engine::RunFixedSteps(float dt) {
+    _fixedTimestep.SetRate(_fixedUpdateRate.load());
+
+    // A throttled engine updates less often on purpose, let the fixed steps
+    // cover the whole gap rather than reporting them as dropped
+    int maxSteps = _maxFixedStepsPerFrame.load();
+    float throttle = _frameInterval.load();
+    if (throttle > 0.0f) {
+        maxSteps = std::max(maxSteps, static_cast<int>(std::ceil(throttle * _fixedTimestep.GetRate())) + 1);
+    }
+    _fixedTimestep.SetMaxStepsPerFrame(maxSteps);
+
+    uint64_t droppedBefore = _fixedTimestep.GetDroppedSteps();
+    int steps = _fixedTimestep.Advance(dt);
+    float fixedDt = _fixedTimestep.GetStepSize();
+
+    for (int i = 0; i < steps; ++i) {
+        FixedUpdate(fixedDt);
+        _fixedHistory.Record(_renderProxies);
+    }
+
+    uint64_t dropped = _fixedTimestep.GetDroppedSteps();
+    if (dropped != droppedBefore) {
+        _droppedStepsLogged = std::min(_droppedStepsLogged, droppedBefore);
+        auto now = std::chrono::steady_clock::now();
+        if (std::chrono::duration<float>(now - _lastDroppedStepLog).count() >= DROPPED_STEP_LOG_INTERVAL) {
+            spdlog::warn("[Engine::RunFixedSteps] Engine {} fell behind, dropped {} fixed steps since last report ({} total)",
+                _ID, dropped - _droppedStepsLogged, dropped);
+            _droppedStepsLogged = dropped;
+            _lastDroppedStepLog = now;
+        }
+    }
+
+    _interpolationAlpha.store(_fixedTimestep.GetAlpha());
+}
+
+void Engine::BuildUpdateGraph() {
+    _updateGraph = std::make_unique<SystemGraph>("Update" + std::to_string(_ID));
+
+    // Lua state is only ever touched from the update thread
+    _updateGraph->AddSystem("FixedUpdate", [this](const SystemFrameContext& context) {
+        if (isPaused.load()) return;
+        auto start = std::chrono::steady_clock::now();
+        RunFixedSteps(context.deltaTime);
+        _scriptMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        })
+        .Writes("Scripts")
+        .Writes("RenderProxies")
+        .Writes("FixedHistory")
+        .Affinity(SystemAffinity::CallingThread);
+
+    _updateGraph->AddSystem("ScriptUpdate", [this](const SystemFrameContext& context) {
+        if (isPaused.load()) return;
+        auto start = std::chrono::steady_clock::now();
+        Update(context.deltaTime);
+        _scriptMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        })
+        .Reads("Input")
+        .Writes("Scripts")
+        .Writes("RenderProxies")
+        .Affinity(SystemAffinity::CallingThread);
+
+    _updateGraph->AddSystem("SnapshotCapture", [this](const SystemFrameContext& context) {
+        CaptureSnapshot(context.deltaTime);
+        })
+        .Reads("RenderProxies")
+        .Reads("FixedHistory")
+        .Writes("Snapshot")
+        .Affinity(SystemAffinity::CallingThread);
+
+    _updateGraph->AddSystem("TransformPropagation", [this](const SystemFrameContext&) {
+        if (_pendingSnapshot) _pendingSnapshot->BuildTransforms(_threadPool.get());
+        })
+        .Writes("Snapshot");
+}
+
+void Engine::CaptureSnapshot(float dt) {
+    FrameSnapshot& snapshot = _snapshots.BeginWrite();
+    snapshot.frameIndex = _publishedFrame.load() + 1;
+    snapshot.deltaTime = dt;
+    snapshot.fixedDeltaTime = _fixedTimestep.GetStepSize();
+    snapshot.interpolationAlpha = _fixedTimestep.GetAlpha();
+    snapshot.Capture(_renderProxies, &_fixedHistory);
+
+    _pendingSnapshot = &snapshot;
+}
+
+void Engine::PublishSnapshot() {
+    if (!_pendingSnapshot) return;
+
+    uint64_t frameIndex = _pendingSnapshot->frameIndex;
+    _pendingSnapshot = nullptr;
+    _snapshots.Publish();
+
+    {
+        std::lock_guard<std::mutex> lock(_pacingMutex);
+        _publishedFrame.store(frameIndex);
+    }
+    _pacingCV.notify_all();
+}
+
 void Engine::Update(float dt) {
     if (_scriptSystem) {
         _scriptSystem->Update(dt);
@@ -276,13 +340,30 @@ void Engine::FixedUpdate(float fixedDt) {
 void Engine::RenderFrame() {
     if (!isRunning.load()) return;
 
+    double interval = GetFrameInterval();
+    _frameInterval.store(static_cast<float>(interval));
+    _frameLimiter.MarkFrame(interval);
+
     {
-        std::unique_lock<std::mutex> lock(_dataMutex);
-        _frameCV.wait_for(lock, std::chrono::milliseconds(16),
-            [this] { return _frameReady.load() || !isRunning.load(); });
+        std::unique_lock<std::mutex> lock(_pacingMutex);
+        _pacingCV.wait_for(lock, std::chrono::milliseconds(16),
+            [this] { return _publishedFrame.load() > _consumedFrame.load() || !isRunning.load(); });
 
         if (!isRunning.load()) return;
-        _frameReady.store(false);
+    }
+
+    // Latch the newest snapshot and let the update thread start on the next one
+    const FrameSnapshot& snapshot = _snapshots.AcquireLatest();
+    {
+        std::lock_guard<std::mutex> lock(_pacingMutex);
+        _consumedFrame.store(snapshot.frameIndex);
+    }
+    _pacingCV.notify_all();
+
+    // Destroying GLFW windows is main thread only, a render thread just
+    // skips closed windows until the manager removes them
+    if (!IsRenderThreadActive() && !RemoveClosedWindows()) {
+        return;
     }
 
     int windowCount = _windowManager->Count();
@@ -292,6 +373,13 @@ void Engine::RenderFrame() {
         return;
     }
 
+    // Backend counters on this thread land in this engine's telemetry
+    FrameTelemetry::Scope telemetryScope(&_telemetry);
+    FrameLimiter::Clock::time_point renderStart = FrameLimiter::Clock::now();
+    float frameMs = _lastRenderTime.time_since_epoch().count() == 0 ? 0.0f :
+        std::chrono::duration<float, std::milli>(renderStart - _lastRenderTime).count();
+    _lastRenderTime = renderStart;
+
     for (int i = windowCount - 1; i >= 0; --i) {
         Window* window = _windowManager->GetWindowAt(i);
 
@@ -300,26 +388,119 @@ void Engine::RenderFrame() {
             continue;
         }
 
-        if (!window->IsOpen()) {
-            spdlog::info("[Engine::RenderFrame] Window {} closed, removing from manager", window->GetID());
-            _windowManager->RemoveWindow(window->GetID());
-
-            if (_windowManager->Count() == 0) {
-                spdlog::info("[Engine::RenderFrame] Last window closed, stopping engine {}", _ID);
-                isRunning.store(false);
-                break;
-            }
+        if (!window->IsOpen() || window->IsIconified()) {
             continue;
         }
 
         window->Render();
     }
 
+    float renderMs = std::chrono::duration<float, std::milli>(FrameLimiter::Clock::now() - renderStart).count();
+    _telemetry.EndFrame(snapshot.frameIndex, frameMs, renderMs);
+}
+
+EngineActivity Engine::GetActivity() {
+    if (!_windowManager) return EngineActivity::Hidden;
+
+    bool anyVisible = false;
+    bool anyFocused = false;
+
+    for (int i = _windowManager->Count() - 1; i >= 0; --i) {
+        Window* window = _windowManager->GetWindowAt(i);
+        if (!window || !window->IsOpen() || window->IsIconified()) continue;
+
+        anyVisible = true;
+        anyFocused = anyFocused || window->IsFocused();
+    }
+
+    if (!anyVisible) return EngineActivity::Hidden;
+    if (isPaused.load() || !anyFocused) return EngineActivity::Background;
+    return EngineActivity::Active;
+}
+
+double Engine::GetFrameInterval() {
+    float target = _targetFPS.load();
+    double interval = target > 0.0f ? 1.0 / target : 0.0;
+
+    switch (GetActivity()) {
+    case EngineActivity::Hidden:
+        return std::max(interval, 1.0 / HIDDEN_FPS);
+    case EngineActivity::Background:
+        return std::max(interval, 1.0 / _backgroundFPS.load());
+    default:
+        return interval;
+    }
+}
+
+bool Engine::HasClosedWindows() {
+    if (!_windowManager) return false;
+
+    for (int i = _windowManager->Count() - 1; i >= 0; --i) {
+        Window* window = _windowManager->GetWindowAt(i);
+        if (window && !window->IsOpen()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Engine::RemoveClosedWindows() {
+    if (!_windowManager) return false;
+
+    for (int i = _windowManager->Count() - 1; i >= 0; --i) {
+        Window* window = _windowManager->GetWindowAt(i);
+        if (!window || window->IsOpen()) continue;
+
+        spdlog::info("[Engine::RemoveClosedWindows] Window {} closed, removing from manager", window->GetID());
+        _windowManager->RemoveWindow(window->GetID());
+    }
+
+    if (_windowManager->Count() == 0) {
+        spdlog::info("[Engine::RemoveClosedWindows] Last window closed, stopping engine {}", _ID);
+        isRunning.store(false);
+        return false;
+    }
+    return true;
+}
+
+void Engine::StartRenderThread() {
+    if (_renderThread && _renderThread->joinable()) {
+        spdlog::warn("[Engine::StartRenderThread] Render thread already running for engine {}", _ID);
+        return;
+    }
+
+    _renderThreadActive.store(true);
+    _renderThread = std::make_unique<std::thread>(&Engine::RenderLoop, this);
+    spdlog::info("[Engine::StartRenderThread] Started render thread for engine {}", _ID);
+}
+
+void Engine::StopRenderThread() {
+    if (!_renderThread) return;
+
+    _renderThreadActive.store(false);
     {
-        std::lock_guard<std::mutex> lock(_dataMutex);
-        _renderComplete.store(true);
+        std::lock_guard<std::mutex> lock(_pacingMutex);
+    }
+    _pacingCV.notify_all();
+
+    if (_renderThread->joinable()) {
+        _renderThread->join();
     }
-    _frameCV.notify_all();
+    _renderThread.reset();
+    spdlog::info("[Engine::StopRenderThread] Stopped render thread for engine {}", _ID);
+}
+
+void Engine::RenderLoop() {
+    spdlog::info("[Engine::RenderLoop] Render thread started for engine {}", _ID);
+
+    while (_renderThreadActive.load() && isRunning.load()) {
+        RenderFrame();
+        _frameLimiter.WaitForNextFrame(&_renderThreadActive);
+    }
+
+    // Hand every context back so the main thread can tear windows down
+    glfwMakeContextCurrent(nullptr);
+    spdlog::info("[Engine::RenderLoop] Render thread exited for engine {}", _ID);
 }
 
 void Engine::Run() {
@@ -335,6 +516,7 @@ void Engine::Run() {
     while (isRunning.load()) {
         glfwPollEvents();
         RenderFrame();
+        _frameLimiter.WaitForNextFrame(&isRunning);
     }
 
     spdlog::info("[Engine::Run] Main loop ended for engine {}", _ID);
@@ -350,6 +532,7 @@ void Engine::Shutdown() {
 
     isRunning.store(false);
     StopUpdateThread();
+    StopRenderThread();
 
     if (_scriptSystem) {
         _scriptSystem->Shutdown();
@@ -433,22 +616,52 @@ void EngineManager::RunAllEngines() {
         }
     }
 
-    FrameTimer timer;
+    // Frame pacing sleeps in 1 ms slices, ask Windows for a timer that can
+    // honour them instead of the default 15.6 ms tick
+    timeBeginPeriod(1);
 
-    while (_running.load()) {
-        timer.Update();
-        float dt = timer.GetDeltaTime();
+    if (_threadedRendering.load()) {
+        RunThreaded();
+    }
+    else {
+        RunSerial();
+    }
+
+    timeEndPeriod(1);
+
+    spdlog::info("[EngineManager] Main loop exited, ensuring all engines are shutdown");
+
+    for (auto& engine : _engines) {
+        if (engine && engine->IsRunning()) {
+            engine->Shutdown();
+        }
+    }
+
+    glfwTerminate();
+}
+
+void EngineManager::RunSerial() {
+    FrameLimiter limiter;
 
+    while (_running.load()) {
         glfwPollEvents();
 
+        auto now = FrameLimiter::Clock::now();
+        auto nextFrame = now + std::chrono::seconds(1);
         bool anyRunning = false;
+        bool anyActive = false;
 
         for (auto& enginePtr : _engines) {
             Engine* engine = enginePtr.get();
             if (!engine || !engine->IsRunning()) continue;
 
             anyRunning = true;
-            engine->RenderFrame();
+            if (engine->IsFrameDue(now)) {
+                engine->RenderFrame();
+            }
+
+            nextFrame = std::min(nextFrame, engine->GetNextFrameTime());
+            anyActive = anyActive || engine->GetActivity() == EngineActivity::Active;
         }
 
         if (!anyRunning) {
@@ -456,17 +669,82 @@ void EngineManager::RunAllEngines() {
             _running.store(false);
             break;
         }
+
+        if (anyActive) {
+            limiter.WaitUntil(nextFrame);
+        }
+        else {
+            // Nothing has focus, block in the event queue so input or a
+            // restore wakes us straight away
+            double timeout = std::chrono::duration<double>(nextFrame - FrameLimiter::Clock::now()).count();
+            if (timeout > 0.0) {
+                glfwWaitEventsTimeout(timeout);
+            }
+        }
     }
+}
 
-    spdlog::info("[EngineManager] Main loop exited, ensuring all engines are shutdown");
+void EngineManager::RunThreaded() {
+    spdlog::info("[EngineManager] Threaded rendering enabled, one render thread per engine");
 
-    for (auto& engine : _engines) {
-        if (engine && engine->IsRunning()) {
-            engine->Shutdown();
+    // A context can only be current on one thread, release ours first
+    glfwMakeContextCurrent(nullptr);
+
+    for (auto& enginePtr : _engines) {
+        if (enginePtr && enginePtr->IsRunning()) {
+            enginePtr->StartRenderThread();
         }
     }
 
-    glfwTerminate();
+    while (_running.load()) {
+        {
+            // GLFW callbacks feed ImGui input, keep them away from ImGui frames
+            std::lock_guard<std::recursive_mutex> uiLock(UIX::GetSharedMutex());
+            glfwPollEvents();
+        }
+
+        bool anyRunning = false;
+        bool anyActive = false;
+
+        for (auto& enginePtr : _engines) {
+            Engine* engine = enginePtr.get();
+            if (!engine) continue;
+
+            if (!engine->IsRunning()) {
+                engine->StopRenderThread();
+                continue;
+            }
+
+            anyRunning = true;
+            anyActive = anyActive || engine->GetActivity() == EngineActivity::Active;
+
+            if (engine->HasClosedWindows()) {
+                // Park the render thread so windows can be destroyed here
+                engine->StopRenderThread();
+                engine->RemoveClosedWindows();
+                glfwMakeContextCurrent(nullptr);
+
+                if (engine->IsRunning()) {
+                    engine->StartRenderThread();
+                }
+            }
+        }
+
+        if (!anyRunning) {
+            spdlog::info("[EngineManager] All engines have stopped running, exiting main loop");
+            _running.store(false);
+            break;
+        }
+
+        // Render threads pace themselves, this only bounds input latency
+        std::this_thread::sleep_for(std::chrono::milliseconds(anyActive ? 1 : 10));
+    }
+
+    for (auto& enginePtr : _engines) {
+        if (enginePtr) {
+            enginePtr->StopRenderThread();
+        }
+    }
 }
 
 bool EngineManager::DestroyEngine(int engineID) {
@@ -6,33 +6,20 @@
 
 #include "../common.h"
 #include "window.h"
+#include "job_system.h"
+#include "frame_allocator.h"
+#include "system_graph.h"
+#include "telemetry.h"
+#include "../renderer/frame_snapshot.h"
 #include "../scripting/script_system.h"
 
 class ScriptSystem;
 
-class ThreadPool {
-private:
-    std::vector<std::thread> _workers;
-    std::queue<std::function<void()>> _tasks;
-    std::mutex _queueMutex;
-    std::condition_variable _condition;
-    std::atomic<bool> _stop{ false };
-
-public:
-    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
-    ~ThreadPool();
-
-    template<class F>
-    void Enqueue(F&& f) {
-        {
-            std::lock_guard<std::mutex> lock(_queueMutex);
-            _tasks.emplace(std::forward<F>(f));
-        }
-        _condition.notify_one();
-    }
-
-    void Wait();
-    size_t GetThreadCount() const { return _workers.size(); }
+// How much of the machine an engine should get, derived from its windows
+enum class EngineActivity {
+    Active,      // a window has focus
+    Background,  // paused, or visible without focus
+    Hidden       // every window minimised, nothing is drawn
 };
 
 class Window;
@@ -52,17 +39,64 @@ private:
     int _ID;
 
     std::unique_ptr<std::thread> _updateThread;
+    std::unique_ptr<std::thread> _renderThread;
+    std::atomic<bool> _renderThreadActive{ false };
     std::unique_ptr<ThreadPool> _threadPool;  
-    std::mutex _dataMutex;
-    std::condition_variable _frameCV;
-    std::atomic<bool> _frameReady{ false };
-    std::atomic<bool> _renderComplete{ true };
+
+    // Transient per-frame memory, flipped by the update thread each frame
+    FrameAllocator _frameAllocator;
+
+    // Systems run by the update thread every frame
+    std::unique_ptr<SystemGraph> _updateGraph;
+
+    FrameTelemetry _telemetry;
+    float _scriptMs = 0.0f;                           // update thread only
+    FrameLimiter::Clock::time_point _lastRenderTime;  // rendering thread only
+
+    // Update publishes snapshots, render consumes the newest one. The update
+    // thread may run at most one frame ahead of the frame being drawn.
+    FrameSnapshotBuffer _snapshots;
+    FrameSnapshot* _pendingSnapshot = nullptr;
+    std::mutex _pacingMutex;
+    std::condition_variable _pacingCV;
+    std::atomic<uint64_t> _publishedFrame{ 0 };
+    std::atomic<uint64_t> _consumedFrame{ 0 };
 
     std::atomic<float> _deltaTime{ 0.0f };
     std::atomic<uint64_t> _frameCount{ 0 };
 
+    // Written by scripts and read by snapshot capture, update thread only
+    RenderProxyStore _renderProxies;
+
+    // Owned by the update thread, configured through the atomics below
+    FixedTimestep _fixedTimestep;
+    FixedStepHistory _fixedHistory;
+    std::atomic<float> _fixedUpdateRate{ 60.0f };
+    std::atomic<int> _maxFixedStepsPerFrame{ 5 };
+    std::atomic<float> _interpolationAlpha{ 0.0f };
+
+    // Dropped steps are reported at most once per interval so a long hitch
+    // doesn't log every frame
+    static constexpr float DROPPED_STEP_LOG_INTERVAL = 1.0f;
+    uint64_t _droppedStepsLogged = 0;
+    std::chrono::steady_clock::time_point _lastDroppedStepLog{};
+
+    // Frame pacing. The limiter is only touched by whichever thread renders,
+    // a target of 0 leaves the rate to vsync.
+    FrameLimiter _frameLimiter;
+    std::atomic<float> _targetFPS{ 0.0f };
+    std::atomic<float> _backgroundFPS{ 15.0f };
+    std::atomic<float> _frameInterval{ 0.0f };
+
+    static constexpr float HIDDEN_FPS = 4.0f;
+
     void Init();
     void UpdateLoop(); 
+    void RenderLoop();
+    void RunFixedSteps(float dt);
+    void BuildUpdateGraph();
+    void CaptureSnapshot(float dt);
+    void PublishSnapshot();
 
 public:
     Engine(const std::string& title);
@@ -71,6 +105,14 @@ public:
     void StartUpdateThread();
     void StopUpdateThread();
 
+    // Threaded rendering: the engine's windows are drawn on their own thread.
+    // GLFW window lifetime stays on the main thread, see RemoveClosedWindows().
+    void StartRenderThread();
+    void StopRenderThread();
+    bool IsRenderThreadActive() const { return _renderThreadActive.load(); }
+    bool HasClosedWindows();
+    bool RemoveClosedWindows();
+
     void Update(float dt);    
 	void FixedUpdate(float fixedDt);
     void RenderFrame();       
@@ -78,6 +120,11 @@ public:
     void Run();
     void Shutdown();
 
+    EngineActivity GetActivity();
+    double GetFrameInterval();
+    bool IsFrameDue(FrameLimiter::Clock::time_point now) const { return _frameLimiter.IsFrameDue(now); }
+    FrameLimiter::Clock::time_point GetNextFrameTime() const { return _frameLimiter.GetNextFrameTime(); }
+
     bool IsRunning() const { return isRunning.load(); }
     bool IsPaused() const { return isPaused.load(); }
     void SetPaused(bool paused) { isPaused.store(paused); }
@@ -90,11 +137,31 @@ public:
     }
     WindowManager* GetWindowManager() const { return _windowManager.get(); }
     ThreadPool* GetThreadPool() const { return _threadPool.get(); }
+    FrameAllocator& GetFrameAllocator() { return _frameAllocator; }
+    SystemGraph* GetUpdateGraph() const { return _updateGraph.get(); }
+    FrameTelemetry& GetTelemetry() { return _telemetry; }
+    const FrameTelemetry& GetTelemetry() const { return _telemetry; }
     ScriptSystem* GetScriptSystem() const { return _scriptSystem.get(); }
+    RenderProxyStore& GetRenderProxies() { return _renderProxies; }
+
+    // Snapshot being drawn this frame, only valid on the render thread
+    const FrameSnapshot& GetRenderSnapshot() const { return _snapshots.GetCurrentRead(); }
 
     int GetID() const { return _ID; }
     float GetDeltaTime() const { return _deltaTime.load(); }
     uint64_t GetFrameCount() const { return _frameCount.load(); }
+
+    void SetFixedUpdateRate(float hz) { _fixedUpdateRate.store(std::clamp(hz, 1.0f, 1000.0f)); }
+    float GetFixedUpdateRate() const { return _fixedUpdateRate.load(); }
+    float GetFixedDeltaTime() const { return 1.0f / _fixedUpdateRate.load(); }
+    void SetMaxFixedStepsPerFrame(int steps) { _maxFixedStepsPerFrame.store(std::max(1, steps)); }
+    int GetMaxFixedStepsPerFrame() const { return _maxFixedStepsPerFrame.load(); }
+    float GetInterpolationAlpha() const { return _interpolationAlpha.load(); }
+
+    void SetTargetFPS(float fps) { _targetFPS.store(fps > 0.0f ? std::clamp(fps, 1.0f, 1000.0f) : 0.0f); }
+    float GetTargetFPS() const { return _targetFPS.load(); }
+    void SetBackgroundFPS(float fps) { _backgroundFPS.store(std::clamp(fps, 1.0f, 1000.0f)); }
+    float GetBackgroundFPS() const { return _backgroundFPS.load(); }
 };
 
 class EngineManager {
@@ -105,6 +172,10 @@ private:
     static std::unique_ptr<EngineManager> s_instance;
 
     std::atomic<bool> _running{ false };
+    std::atomic<bool> _threadedRendering{ false };
+
+    void RunSerial();
+    void RunThreaded();
 
 public:
     EngineManager() = default;
@@ -115,6 +186,10 @@ public:
 
     void RunAllEngines();
 
+    // Opt-in, takes effect on the next RunAllEngines()
+    void SetThreadedRendering(bool enabled) { _threadedRendering.store(enabled); }
+    bool IsThreadedRendering() const { return _threadedRendering.load(); }
+
     int CreateEngine(const std::string& title);
     bool DestroyEngine(int engineID);
     void DestroyAllEngines();
@@ -0,0 +1,175 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "frame_allocator.h"
+
+namespace {
+    std::atomic<uint64_t> s_nextAllocatorID{ 1 };
+
+    // A thread usually allocates from one or two engines, remember the last
+    // few arenas it used so the lookup stays lock free
+    struct ThreadArenaCacheEntry {
+        uint64_t allocatorID = 0;
+        void* arena = nullptr;
+    };
+
+    constexpr size_t THREAD_CACHE_SIZE = 4;
+    thread_local std::array<ThreadArenaCacheEntry, THREAD_CACHE_SIZE> t_arenaCache{};
+    thread_local size_t t_arenaCacheNext = 0;
+
+    size_t AlignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+void LinearArena::AddBlock(size_t minSize) {
+    Block block;
+    block.size = std::max(_blockSize, minSize);
+    block.data = std::make_unique<uint8_t[]>(block.size);
+    _blocks.push_back(std::move(block));
+    _blockAllocations++;
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("LinearArena alignment must be a power of two");
+    }
+
+    while (true) {
+        if (_currentBlock < _blocks.size()) {
+            Block& block = _blocks[_currentBlock];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+            size_t start = AlignUp(base + _offset, alignment) - base;
+
+            if (start + size <= block.size) {
+                _usedBytes += (start - _offset) + size;
+                _peakBytes = std::max(_peakBytes, _usedBytes);
+                _offset = start + size;
+                return block.data.get() + start;
+            }
+
+            if (_currentBlock + 1 < _blocks.size()) {
+                _currentBlock++;
+                _offset = 0;
+                continue;
+            }
+        }
+
+        AddBlock(size + alignment);
+        _currentBlock = _blocks.size() - 1;
+        _offset = 0;
+    }
+}
+
+void LinearArena::Reset() {
+    if (_blocks.size() > 1) {
+        size_t total = GetCapacity();
+        _blocks.clear();
+        AddBlock(total);
+    }
+
+    _currentBlock = 0;
+    _offset = 0;
+    _usedBytes = 0;
+}
+
+size_t LinearArena::GetCapacity() const {
+    size_t total = 0;
+    for (const Block& block : _blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+FrameAllocator::FrameAllocator(size_t blockSize)
+    : _blockSize(blockSize)
+    , _ID(s_nextAllocatorID.fetch_add(1, std::memory_order_relaxed)) {
+}
+
+FrameAllocator::~FrameAllocator() = default;
+
+void FrameAllocator::BeginFrame() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    uint32_t next = _activeBuffer.load(std::memory_order_relaxed) ^ 1u;
+
+    size_t recycled = 0;
+    size_t capacity = 0;
+    uint64_t blockAllocations = 0;
+    for (auto& threadArena : _threadArenas) {
+        LinearArena& arena = threadArena->buffers[next];
+        recycled += arena.GetUsedBytes();
+        arena.Reset();
+        capacity += arena.GetCapacity();
+        blockAllocations += arena.GetBlockAllocations();
+    }
+
+    _bufferCapacity[next] = capacity;
+    _bufferBlockAllocations[next] = blockAllocations;
+
+    _lastFrameBytes = recycled;
+    _peakFrameBytes = std::max(_peakFrameBytes, recycled);
+
+    _activeBuffer.store(next, std::memory_order_release);
+    _frameIndex.fetch_add(1, std::memory_order_relaxed);
+}
+
+FrameAllocator::ThreadArena& FrameAllocator::FindOrCreateThreadArena() {
+    for (const ThreadArenaCacheEntry& entry : t_arenaCache) {
+        if (entry.allocatorID == _ID) {
+            return *static_cast<ThreadArena*>(entry.arena);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::thread::id self = std::this_thread::get_id();
+    ThreadArena* found = nullptr;
+    for (auto& threadArena : _threadArenas) {
+        if (threadArena->owner == self) {
+            found = threadArena.get();
+            break;
+        }
+    }
+
+    if (!found) {
+        _threadArenas.push_back(std::make_unique<ThreadArena>(self, _blockSize));
+        found = _threadArenas.back().get();
+    }
+
+    ThreadArenaCacheEntry& slot = t_arenaCache[t_arenaCacheNext];
+    t_arenaCacheNext = (t_arenaCacheNext + 1) % THREAD_CACHE_SIZE;
+    slot.allocatorID = _ID;
+    slot.arena = found;
+
+    return *found;
+}
+
+LinearArena& FrameAllocator::GetArena() {
+    ThreadArena& threadArena = FindOrCreateThreadArena();
+    return threadArena.buffers[_activeBuffer.load(std::memory_order_acquire)];
+}
+
+FrameAllocatorStats FrameAllocator::GetStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    FrameAllocatorStats stats;
+    stats.frameIndex = _frameIndex.load(std::memory_order_relaxed);
+    stats.threadArenas = _threadArenas.size();
+    stats.lastFrameBytes = _lastFrameBytes;
+    stats.peakFrameBytes = _peakFrameBytes;
+    stats.capacity = _bufferCapacity[0] + _bufferCapacity[1];
+    stats.blockAllocations = _bufferBlockAllocations[0] + _bufferBlockAllocations[1];
+
+    return stats;
+}
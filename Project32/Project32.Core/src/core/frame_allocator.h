@@ -0,0 +1,183 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include "../common.h"
+
+// Bump allocator over a list of blocks. Not thread safe, and nothing is freed
+// individually. Reset() rewinds to the start, if the frame spilled into extra
+// blocks they are merged into one so the next frame fits without allocating.
+class LinearArena {
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size = 0;
+    };
+
+    std::vector<Block> _blocks;
+    size_t _blockSize;
+    size_t _currentBlock = 0;
+    size_t _offset = 0;
+    size_t _usedBytes = 0;
+    size_t _peakBytes = 0;
+    uint64_t _blockAllocations = 0;
+
+    void AddBlock(size_t minSize);
+
+public:
+    explicit LinearArena(size_t blockSize = 64 * 1024) : _blockSize(std::max<size_t>(blockSize, 256)) {}
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void Reset();
+
+    size_t GetUsedBytes() const { return _usedBytes; }
+    size_t GetPeakBytes() const { return _peakBytes; }
+    size_t GetCapacity() const;
+    uint64_t GetBlockAllocations() const { return _blockAllocations; }
+};
+
+// STL allocator over a LinearArena, deallocate() is a no-op. Containers must
+// stay on the thread whose arena they were created with and must not outlive
+// the frame.
+template<typename T>
+class FrameStlAllocator {
+private:
+    LinearArena* _arena;
+
+    template<typename U> friend class FrameStlAllocator;
+
+public:
+    using value_type = T;
+
+    explicit FrameStlAllocator(LinearArena& arena) noexcept : _arena(&arena) {}
+
+    template<typename U>
+    FrameStlAllocator(const FrameStlAllocator<U>& other) noexcept : _arena(other._arena) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    LinearArena* GetArena() const noexcept { return _arena; }
+
+    template<typename U>
+    bool operator==(const FrameStlAllocator<U>& other) const noexcept { return _arena == other._arena; }
+    template<typename U>
+    bool operator!=(const FrameStlAllocator<U>& other) const noexcept { return _arena != other._arena; }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameStlAllocator<char>>;
+
+struct FrameAllocatorStats {
+    uint64_t frameIndex = 0;
+    size_t threadArenas = 0;
+    size_t lastFrameBytes = 0;   // used by the buffer that was just recycled
+    size_t peakFrameBytes = 0;
+    size_t capacity = 0;
+    uint64_t blockAllocations = 0;
+};
+
+// Double-buffered per-frame memory. Every thread that allocates gets its own
+// pair of arenas, so allocating never takes a lock after the first call on a
+// thread. BeginFrame() flips to the other buffer and rewinds it, which keeps
+// memory handed out during frame N valid until BeginFrame() of frame N + 2.
+// The render thread can therefore read what the update thread built for the
+// frame it is drawing.
+class FrameAllocator {
+private:
+    struct ThreadArena {
+        std::thread::id owner;
+        std::array<LinearArena, 2> buffers;
+
+        ThreadArena(std::thread::id id, size_t blockSize)
+            : owner(id), buffers{ LinearArena(blockSize), LinearArena(blockSize) } {
+        }
+    };
+
+    std::vector<std::unique_ptr<ThreadArena>> _threadArenas;
+    mutable std::mutex _mutex;
+    std::atomic<uint32_t> _activeBuffer{ 0 };
+    std::atomic<uint64_t> _frameIndex{ 0 };
+    size_t _blockSize;
+    size_t _lastFrameBytes = 0;
+    size_t _peakFrameBytes = 0;
+
+    // Arenas can only be inspected while their buffer is idle, so sizes are
+    // sampled per buffer when BeginFrame() recycles it
+    std::array<size_t, 2> _bufferCapacity{};
+    std::array<uint64_t, 2> _bufferBlockAllocations{};
+    uint64_t _ID;
+
+    ThreadArena& FindOrCreateThreadArena();
+
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    explicit FrameAllocator(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~FrameAllocator();
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    // Called once per frame by the thread that drives the frame
+    void BeginFrame();
+
+    // Arena of the calling thread for the current frame
+    LinearArena& GetArena();
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        return GetArena().Allocate(size, alignment);
+    }
+
+    template<typename T>
+    T* AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed");
+        T* data = static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        std::uninitialized_value_construct_n(data, count);
+        return data;
+    }
+
+    template<typename T, typename... Args>
+    T* New(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed");
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    FrameVector<T> MakeVector(size_t reserve = 0) {
+        FrameVector<T> result{ FrameStlAllocator<T>(GetArena()) };
+        if (reserve > 0) result.reserve(reserve);
+        return result;
+    }
+
+    FrameString MakeString(std::string_view text = {}) {
+        return FrameString(text, FrameStlAllocator<char>(GetArena()));
+    }
+
+    template<typename T>
+    FrameStlAllocator<T> GetStlAllocator() { return FrameStlAllocator<T>(GetArena()); }
+
+    uint64_t GetFrameIndex() const { return _frameIndex.load(std::memory_order_relaxed); }
+    FrameAllocatorStats GetStats() const;
+};
+
+#endif // FRAME_ALLOCATOR_H
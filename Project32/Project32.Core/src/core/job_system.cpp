@@ -0,0 +1,237 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "job_system.h"
+
+namespace {
+    thread_local ThreadPool* t_currentPool = nullptr;
+    thread_local int t_workerIndex = -1;
+
+    constexpr int SPIN_COUNT_BEFORE_SLEEP = 64;
+}
+
+ThreadPool::ThreadPool(size_t threads) {
+    threads = std::max<size_t>(1, threads);
+
+    _queues.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        _queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    _workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        _workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+    spdlog::info("[ThreadPool] Created with {} worker threads", threads);
+}
+
+ThreadPool::~ThreadPool() {
+    Wait();
+
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stop.store(true);
+    }
+    _sleepCV.notify_all();
+
+    for (std::thread& worker : _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    spdlog::info("[ThreadPool] Destroyed ({} jobs executed, {} stolen)",
+        _executedJobs.load(), _stolenJobs.load());
+}
+
+int ThreadPool::GetCurrentWorkerIndex() {
+    return t_workerIndex;
+}
+
+void ThreadPool::Push(JobTask&& task, JobCounter* counter) {
+    _outstandingJobs.fetch_add(1, std::memory_order_relaxed);
+
+    // Workers feed their own deque, everyone else spreads round robin
+    size_t index;
+    if (t_currentPool == this && t_workerIndex >= 0) {
+        index = static_cast<size_t>(t_workerIndex);
+    }
+    else {
+        index = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    }
+
+    WorkerQueue& queue = *_queues[index];
+    {
+        std::lock_guard<SpinLock> lock(queue.lock);
+        queue.jobs.push_back({ std::move(task), counter });
+    }
+
+    _queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+    if (_sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(_sleepMutex); }
+        _sleepCV.notify_one();
+    }
+}
+
+bool ThreadPool::TryPop(size_t index, QueuedJob& out) {
+    WorkerQueue& queue = *_queues[index];
+    std::lock_guard<SpinLock> lock(queue.lock);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+
+    out = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    _queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ThreadPool::TrySteal(size_t thief, QueuedJob& out) {
+    const size_t count = _queues.size();
+    for (size_t i = 1; i <= count; ++i) {
+        size_t victim = (thief + i) % count;
+        WorkerQueue& queue = *_queues[victim];
+
+        if (queue.lock.flag.test(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        std::lock_guard<SpinLock> lock(queue.lock);
+        if (queue.jobs.empty()) {
+            continue;
+        }
+
+        out = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        _queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        _stolenJobs.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::Execute(QueuedJob& job) {
+    try {
+        job.task();
+    }
+    catch (const std::exception& e) {
+        spdlog::error("[ThreadPool::Execute] Job threw an exception: {}", e.what());
+    }
+    catch (...) {
+        spdlog::error("[ThreadPool::Execute] Job threw an unknown exception");
+    }
+
+    _executedJobs.fetch_add(1, std::memory_order_relaxed);
+
+    if (job.counter) {
+        job.counter->_pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    _outstandingJobs.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::WorkerLoop(size_t index) {
+    t_currentPool = this;
+    t_workerIndex = static_cast<int>(index);
+
+    int idleSpins = 0;
+    QueuedJob job;
+
+    while (true) {
+        if (TryPop(index, job) || TrySteal(index, job)) {
+            Execute(job);
+            job.task.Reset();
+            job.counter = nullptr;
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < SPIN_COUNT_BEFORE_SLEEP) {
+            std::this_thread::yield();
+            continue;
+        }
+        idleSpins = 0;
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        _sleepCV.wait(lock, [this] {
+            return _stop.load() || _queuedJobs.load(std::memory_order_seq_cst) > 0;
+            });
+        _sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+
+        if (_stop.load() && _queuedJobs.load() == 0) {
+            break;
+        }
+    }
+
+    t_currentPool = nullptr;
+    t_workerIndex = -1;
+}
+
+void ThreadPool::WaitFor(const JobCounter& counter) {
+    const size_t self = (t_currentPool == this && t_workerIndex >= 0)
+        ? static_cast<size_t>(t_workerIndex) : 0;
+    const bool isWorker = (t_currentPool == this && t_workerIndex >= 0);
+
+    QueuedJob job;
+    while (!counter.IsDone()) {
+        bool found = isWorker ? (TryPop(self, job) || TrySteal(self, job)) : TrySteal(self, job);
+        if (found) {
+            Execute(job);
+            job.task.Reset();
+            job.counter = nullptr;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ThreadPool::WaitFor(const JobHandle& handle) {
+    if (handle._counter) {
+        WaitFor(*handle._counter);
+    }
+}
+
+bool ThreadPool::TryRunPendingJob() {
+    const bool isWorker = (t_currentPool == this && t_workerIndex >= 0);
+    const size_t self = isWorker ? static_cast<size_t>(t_workerIndex) : 0;
+
+    QueuedJob job;
+    bool found = isWorker ? (TryPop(self, job) || TrySteal(self, job)) : TrySteal(self, job);
+    if (!found) return false;
+
+    Execute(job);
+    return true;
+}
+
+void ThreadPool::Wait() {
+    if (t_currentPool == this) {
+        spdlog::error("[ThreadPool::Wait] Called from inside a job, use a JobCounter instead");
+        return;
+    }
+
+    QueuedJob job;
+    while (_outstandingJobs.load(std::memory_order_acquire) > 0) {
+        if (TrySteal(0, job)) {
+            Execute(job);
+            job.task.Reset();
+            job.counter = nullptr;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t ThreadPool::SuggestGrainSize(size_t count, size_t minGrain) const {
+    const size_t chunks = std::max<size_t>(1, (_workers.size() + 1) * 4);
+    return std::max(minGrain, (count + chunks - 1) / chunks);
+}
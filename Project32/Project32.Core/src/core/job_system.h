@@ -0,0 +1,252 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include "../common.h"
+
+#include <deque>
+
+// Move-only callable with inline storage. Closures up to INLINE_SIZE bytes
+// (a few pointers / indices) never touch the heap, bigger ones fall back to
+// a single allocation.
+class JobTask {
+public:
+    static constexpr size_t INLINE_SIZE = 48;
+
+    JobTask() = default;
+
+    template<class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, JobTask>>>
+    JobTask(F&& f) {
+        using Fn = std::decay_t<F>;
+        if constexpr (sizeof(Fn) <= INLINE_SIZE && alignof(Fn) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<Fn>) {
+            new (_storage) Fn(std::forward<F>(f));
+            _invoke = [](void* p) { (*static_cast<Fn*>(p))(); };
+            _manage = [](void* dst, void* src) {
+                if (dst) new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+                static_cast<Fn*>(src)->~Fn();
+            };
+        }
+        else {
+            *reinterpret_cast<Fn**>(_storage) = new Fn(std::forward<F>(f));
+            _invoke = [](void* p) { (**static_cast<Fn**>(p))(); };
+            _manage = [](void* dst, void* src) {
+                if (dst) *static_cast<Fn**>(dst) = *static_cast<Fn**>(src);
+                else delete *static_cast<Fn**>(src);
+            };
+        }
+    }
+
+    JobTask(JobTask&& other) noexcept { MoveFrom(other); }
+
+    JobTask& operator=(JobTask&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    JobTask(const JobTask&) = delete;
+    JobTask& operator=(const JobTask&) = delete;
+
+    ~JobTask() { Reset(); }
+
+    void operator()() { _invoke(_storage); }
+    explicit operator bool() const { return _invoke != nullptr; }
+
+    void Reset() {
+        if (_manage) {
+            _manage(nullptr, _storage);
+        }
+        _invoke = nullptr;
+        _manage = nullptr;
+    }
+
+private:
+    void MoveFrom(JobTask& other) {
+        if (other._manage) {
+            other._manage(_storage, other._storage);
+        }
+        _invoke = other._invoke;
+        _manage = other._manage;
+        other._invoke = nullptr;
+        other._manage = nullptr;
+    }
+
+    alignas(std::max_align_t) unsigned char _storage[INLINE_SIZE];
+    void (*_invoke)(void*) = nullptr;
+    void (*_manage)(void* dst, void* src) = nullptr;
+};
+
+// Counts outstanding jobs scheduled against it. Lives on the caller's stack
+// for fork/join work, or behind a JobHandle when the waiter is elsewhere.
+class JobCounter {
+private:
+    std::atomic<uint32_t> _pending{ 0 };
+    friend class ThreadPool;
+
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return _pending.load(std::memory_order_acquire) == 0; }
+    uint32_t GetPending() const { return _pending.load(std::memory_order_acquire); }
+};
+
+class JobHandle {
+private:
+    std::shared_ptr<JobCounter> _counter;
+    friend class ThreadPool;
+
+public:
+    JobHandle() = default;
+    explicit JobHandle(std::shared_ptr<JobCounter> counter) : _counter(std::move(counter)) {}
+
+    bool IsValid() const { return _counter != nullptr; }
+    bool IsDone() const { return !_counter || _counter->IsDone(); }
+};
+
+class ThreadPool {
+private:
+    struct SpinLock {
+        std::atomic_flag flag = ATOMIC_FLAG_INIT;
+
+        void lock() {
+            while (flag.test_and_set(std::memory_order_acquire)) {
+                while (flag.test(std::memory_order_relaxed)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        void unlock() { flag.clear(std::memory_order_release); }
+    };
+
+    struct QueuedJob {
+        JobTask task;
+        JobCounter* counter = nullptr;
+    };
+
+    // Owner pushes/pops at the back (LIFO, cache warm), thieves take from
+    // the front so they grab the oldest and usually largest work.
+    struct alignas(64) WorkerQueue {
+        SpinLock lock;
+        std::deque<QueuedJob> jobs;
+    };
+
+    std::vector<std::thread> _workers;
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCV;
+    std::atomic<uint32_t> _sleepingWorkers{ 0 };
+
+    std::atomic<bool> _stop{ false };
+    std::atomic<uint32_t> _queuedJobs{ 0 };
+    std::atomic<uint32_t> _outstandingJobs{ 0 };
+    std::atomic<uint32_t> _nextQueue{ 0 };
+
+    std::atomic<uint64_t> _executedJobs{ 0 };
+    std::atomic<uint64_t> _stolenJobs{ 0 };
+
+    void WorkerLoop(size_t index);
+    void Push(JobTask&& task, JobCounter* counter);
+    bool TryPop(size_t index, QueuedJob& out);
+    bool TrySteal(size_t thief, QueuedJob& out);
+    void Execute(QueuedJob& job);
+
+public:
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Fire and forget, only tracked by Wait()
+    template<class F>
+    void Enqueue(F&& f) {
+        Push(JobTask(std::forward<F>(f)), nullptr);
+    }
+
+    template<class F>
+    void Schedule(JobCounter& counter, F&& f) {
+        counter._pending.fetch_add(1, std::memory_order_relaxed);
+        Push(JobTask(std::forward<F>(f)), &counter);
+    }
+
+    template<class F>
+    JobHandle Submit(F&& f) {
+        auto counter = std::make_shared<JobCounter>();
+        counter->_pending.store(1, std::memory_order_relaxed);
+        // The job keeps its own counter alive so the handle may be dropped early
+        Push(JobTask([counter, fn = std::forward<F>(f)]() mutable { fn(); }), counter.get());
+        return JobHandle(std::move(counter));
+    }
+
+    // Runs fn(first, last) over [begin, end) in chunks of grainSize. The
+    // calling thread takes part and the call returns once every chunk ran.
+    template<class F>
+    void ParallelForRange(size_t begin, size_t end, size_t grainSize, F&& fn) {
+        if (begin >= end) return;
+        grainSize = std::max<size_t>(1, grainSize);
+
+        if (end - begin <= grainSize || _workers.empty()) {
+            fn(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+        for (size_t first = begin + grainSize; first < end; first += grainSize) {
+            size_t last = std::min(first + grainSize, end);
+            Schedule(counter, [&fn, first, last]() { fn(first, last); });
+        }
+
+        fn(begin, std::min(begin + grainSize, end));
+        WaitFor(counter);
+    }
+
+    template<class F>
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, F&& fn) {
+        ParallelForRange(begin, end, grainSize, [&fn](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                fn(i);
+            }
+            });
+    }
+
+    // Helps run queued jobs until the counter reaches zero
+    void WaitFor(const JobCounter& counter);
+    void WaitFor(const JobHandle& handle);
+
+    // Runs one queued job on the calling thread, false when none was found
+    bool TryRunPendingJob();
+
+    // Waits for every job, including those already running on a worker.
+    // Not callable from inside a job.
+    void Wait();
+
+    // Picks a grain size that gives each thread a few chunks to steal
+    size_t SuggestGrainSize(size_t count, size_t minGrain = 16) const;
+
+    size_t GetThreadCount() const { return _workers.size(); }
+    uint64_t GetExecutedJobCount() const { return _executedJobs.load(std::memory_order_relaxed); }
+    uint64_t GetStolenJobCount() const { return _stolenJobs.load(std::memory_order_relaxed); }
+
+    // Worker index of the calling thread, -1 when called from outside the pool
+    static int GetCurrentWorkerIndex();
+};
+
+#endif // JOB_SYSTEM_H
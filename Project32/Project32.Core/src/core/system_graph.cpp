@@ -0,0 +1,295 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "system_graph.h"
+
+SystemGraph::SystemBuilder& SystemGraph::SystemBuilder::Reads(std::string_view resource) {
+    _graph->_systems[_index]->reads.push_back(_graph->GetResourceID(resource));
+    _graph->_compiled = false;
+    return *this;
+}
+
+SystemGraph::SystemBuilder& SystemGraph::SystemBuilder::Writes(std::string_view resource) {
+    _graph->_systems[_index]->writes.push_back(_graph->GetResourceID(resource));
+    _graph->_compiled = false;
+    return *this;
+}
+
+SystemGraph::SystemBuilder& SystemGraph::SystemBuilder::Affinity(SystemAffinity affinity) {
+    _graph->_systems[_index]->affinity = affinity;
+    return *this;
+}
+
+SystemGraph::SystemGraph(std::string name)
+    : _name(std::move(name)) {
+}
+
+SystemGraph::~SystemGraph() = default;
+
+SystemGraph::SystemBuilder SystemGraph::AddSystem(std::string name, SystemFn fn) {
+    auto system = std::make_unique<SystemNode>();
+    system->name = std::move(name);
+    system->fn = std::move(fn);
+    _systems.push_back(std::move(system));
+    _compiled = false;
+    return SystemBuilder(this, _systems.size() - 1);
+}
+
+bool SystemGraph::SetSystemEnabled(std::string_view name, bool enabled) {
+    for (auto& system : _systems) {
+        if (system->name == name) {
+            system->enabled = enabled;
+            return true;
+        }
+    }
+    spdlog::warn("[SystemGraph::SetSystemEnabled] No system named '{}' in graph '{}'", name, _name);
+    return false;
+}
+
+uint32_t SystemGraph::GetResourceID(std::string_view resource) {
+    auto it = _resources.find(std::string(resource));
+    if (it != _resources.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(_resources.size());
+    _resources.emplace(std::string(resource), id);
+    return id;
+}
+
+void SystemGraph::Compile() {
+    const size_t resourceCount = _resources.size();
+    std::vector<int> lastWriter(resourceCount, -1);
+    std::vector<std::vector<uint32_t>> readersSinceWrite(resourceCount);
+
+    for (auto& system : _systems) {
+        system->dependencies.clear();
+        system->dependents.clear();
+    }
+
+    for (uint32_t i = 0; i < _systems.size(); ++i) {
+        SystemNode& system = *_systems[i];
+
+        for (uint32_t resource : system.reads) {
+            if (lastWriter[resource] >= 0) {
+                system.dependencies.push_back(static_cast<uint32_t>(lastWriter[resource]));
+            }
+        }
+
+        for (uint32_t resource : system.writes) {
+            if (lastWriter[resource] >= 0) {
+                system.dependencies.push_back(static_cast<uint32_t>(lastWriter[resource]));
+            }
+            for (uint32_t reader : readersSinceWrite[resource]) {
+                system.dependencies.push_back(reader);
+            }
+        }
+
+        std::sort(system.dependencies.begin(), system.dependencies.end());
+        system.dependencies.erase(std::unique(system.dependencies.begin(), system.dependencies.end()),
+            system.dependencies.end());
+        system.dependencies.erase(std::remove(system.dependencies.begin(), system.dependencies.end(), i),
+            system.dependencies.end());
+
+        for (uint32_t dependency : system.dependencies) {
+            _systems[dependency]->dependents.push_back(i);
+        }
+
+        for (uint32_t resource : system.reads) {
+            readersSinceWrite[resource].push_back(i);
+        }
+        for (uint32_t resource : system.writes) {
+            lastWriter[resource] = static_cast<int>(i);
+            readersSinceWrite[resource].clear();
+        }
+    }
+
+    _compiled = true;
+    spdlog::info("[SystemGraph::Compile] Graph '{}' compiled with {} systems over {} resources",
+        _name, _systems.size(), resourceCount);
+}
+
+void SystemGraph::InvokeSystem(SystemNode& system) {
+    Clock::time_point start = Clock::now();
+
+    if (system.enabled && system.fn) {
+        try {
+            system.fn(*_context);
+        }
+        catch (const std::exception& e) {
+            spdlog::error("[SystemGraph::InvokeSystem] System '{}' in graph '{}' threw: {}", system.name, _name, e.what());
+        }
+    }
+
+    Clock::time_point end = Clock::now();
+    system.startMs = std::chrono::duration<double, std::milli>(start - _frameStart).count();
+    system.durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void SystemGraph::RunSystem(uint32_t index) {
+    SystemNode& system = *_systems[index];
+    InvokeSystem(system);
+
+    // Release dependents before counting this one as done, so _remaining
+    // cannot reach zero while work is still being handed out
+    for (uint32_t dependent : system.dependents) {
+        if (_systems[dependent]->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Dispatch(dependent);
+        }
+    }
+
+    _remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void SystemGraph::Dispatch(uint32_t index) {
+    if (_systems[index]->affinity == SystemAffinity::CallingThread) {
+        std::lock_guard<std::mutex> lock(_callingQueueMutex);
+        _callingQueue.push_back(index);
+        return;
+    }
+
+    _pool->Schedule(*_jobs, [this, index]() { RunSystem(index); });
+}
+
+bool SystemGraph::PopCallingThreadSystem(uint32_t& index) {
+    std::lock_guard<std::mutex> lock(_callingQueueMutex);
+    if (_callingQueue.empty()) return false;
+
+    // Lowest index first keeps calling-thread work in declaration order
+    auto it = std::min_element(_callingQueue.begin(), _callingQueue.end());
+    index = *it;
+    _callingQueue.erase(it);
+    return true;
+}
+
+void SystemGraph::Execute(ThreadPool* pool, const SystemFrameContext& context) {
+    if (!_compiled) {
+        Compile();
+    }
+    if (_systems.empty()) return;
+
+    _context = &context;
+    _frameStart = Clock::now();
+
+    if (!pool || pool->GetThreadCount() == 0) {
+        for (auto& system : _systems) {
+            InvokeSystem(*system);
+        }
+    }
+    else {
+        JobCounter jobs;
+        _pool = pool;
+        _jobs = &jobs;
+        _remaining.store(static_cast<uint32_t>(_systems.size()), std::memory_order_relaxed);
+
+        for (auto& system : _systems) {
+            system->pendingDependencies.store(static_cast<uint32_t>(system->dependencies.size()),
+                std::memory_order_relaxed);
+        }
+
+        for (uint32_t i = 0; i < _systems.size(); ++i) {
+            if (_systems[i]->dependencies.empty()) {
+                Dispatch(i);
+            }
+        }
+
+        while (_remaining.load(std::memory_order_acquire) > 0) {
+            uint32_t index = 0;
+            if (PopCallingThreadSystem(index)) {
+                RunSystem(index);
+            }
+            else if (!pool->TryRunPendingJob()) {
+                std::this_thread::yield();
+            }
+        }
+
+        // The last job may still be unwinding after it counted itself done
+        pool->WaitFor(jobs);
+        _jobs = nullptr;
+        _pool = nullptr;
+    }
+
+    double wallMs = std::chrono::duration<double, std::milli>(Clock::now() - _frameStart).count();
+    BuildReport(context.frameIndex, wallMs);
+    _context = nullptr;
+}
+
+void SystemGraph::BuildReport(uint64_t frameIndex, double wallMs) {
+    const size_t count = _systems.size();
+
+    // Systems are stored in a valid topological order, so one forward pass
+    // finds the longest chain ending at each system
+    std::vector<double> finish(count, 0.0);
+    std::vector<int> previous(count, -1);
+    size_t last = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const SystemNode& system = *_systems[i];
+        double start = 0.0;
+        for (uint32_t dependency : system.dependencies) {
+            if (finish[dependency] > start) {
+                start = finish[dependency];
+                previous[i] = static_cast<int>(dependency);
+            }
+        }
+        finish[i] = start + system.durationMs;
+        if (finish[i] > finish[last]) {
+            last = i;
+        }
+    }
+
+    SystemGraphReport report;
+    report.frameIndex = frameIndex;
+    report.wallMs = wallMs;
+    report.criticalPathMs = finish[last];
+    report.systems.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const SystemNode& system = *_systems[i];
+        report.systems[i].name = system.name;
+        report.systems[i].startMs = system.startMs;
+        report.systems[i].durationMs = system.durationMs;
+        report.workMs += system.durationMs;
+    }
+
+    for (int i = static_cast<int>(last); i >= 0; i = previous[i]) {
+        report.systems[i].critical = true;
+        report.criticalPath.push_back(static_cast<size_t>(i));
+    }
+    std::reverse(report.criticalPath.begin(), report.criticalPath.end());
+
+    std::lock_guard<std::mutex> lock(_reportMutex);
+    _lastReport = std::move(report);
+}
+
+SystemGraphReport SystemGraph::GetLastReport() const {
+    std::lock_guard<std::mutex> lock(_reportMutex);
+    return _lastReport;
+}
+
+void SystemGraph::LogReport() const {
+    SystemGraphReport report = GetLastReport();
+
+    std::string path;
+    for (size_t index : report.criticalPath) {
+        if (!path.empty()) path += " -> ";
+        path += report.systems[index].name;
+    }
+
+    spdlog::info("[SystemGraph::LogReport] '{}' frame {}: wall {:.3f} ms, work {:.3f} ms, critical path {:.3f} ms ({})",
+        _name, report.frameIndex, report.wallMs, report.workMs, report.criticalPathMs, path);
+
+    for (const SystemTiming& timing : report.systems) {
+        spdlog::info("[SystemGraph::LogReport]   {}{} start {:.3f} ms, took {:.3f} ms",
+            timing.critical ? "* " : "  ", timing.name, timing.startMs, timing.durationMs);
+    }
+}
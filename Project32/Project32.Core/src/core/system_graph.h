@@ -0,0 +1,135 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef SYSTEM_GRAPH_H
+#define SYSTEM_GRAPH_H
+
+#include "../common.h"
+#include "job_system.h"
+
+struct SystemFrameContext {
+    float deltaTime = 0.0f;
+    uint64_t frameIndex = 0;
+};
+
+enum class SystemAffinity : uint8_t {
+    Any,            // any pool worker may run it
+    CallingThread   // only the thread calling Execute(), for Lua, GL and ImGui work
+};
+
+struct SystemTiming {
+    std::string name;
+    double startMs = 0.0;
+    double durationMs = 0.0;
+    bool critical = false;
+};
+
+struct SystemGraphReport {
+    uint64_t frameIndex = 0;
+    double wallMs = 0.0;          // whole Execute() call
+    double workMs = 0.0;          // sum of every system
+    double criticalPathMs = 0.0;  // longest dependency chain by measured time
+    std::vector<SystemTiming> systems;
+    std::vector<size_t> criticalPath;
+};
+
+// Systems declare which resources they read and write, dependencies follow
+// from declaration order: a reader waits for the last writer, a writer waits
+// for the last writer and every reader since. Systems with no path between
+// them run at the same time on the thread pool.
+class SystemGraph {
+public:
+    using SystemFn = std::function<void(const SystemFrameContext&)>;
+
+    class SystemBuilder {
+    private:
+        SystemGraph* _graph;
+        size_t _index;
+
+    public:
+        SystemBuilder(SystemGraph* graph, size_t index) : _graph(graph), _index(index) {}
+
+        SystemBuilder& Reads(std::string_view resource);
+        SystemBuilder& Writes(std::string_view resource);
+        SystemBuilder& Affinity(SystemAffinity affinity);
+    };
+
+    explicit SystemGraph(std::string name);
+    ~SystemGraph();
+
+    SystemGraph(const SystemGraph&) = delete;
+    SystemGraph& operator=(const SystemGraph&) = delete;
+
+    SystemBuilder AddSystem(std::string name, SystemFn fn);
+
+    // A disabled system is skipped but still orders the systems around it
+    bool SetSystemEnabled(std::string_view name, bool enabled);
+
+    // Resolves dependencies, done on the first Execute() after a change
+    void Compile();
+
+    // Runs every system once and returns when all of them finished. Without
+    // a pool (or with an empty one) the systems run in declaration order.
+    void Execute(ThreadPool* pool, const SystemFrameContext& context);
+
+    SystemGraphReport GetLastReport() const;
+    void LogReport() const;
+
+    const std::string& GetName() const { return _name; }
+    size_t GetSystemCount() const { return _systems.size(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct SystemNode {
+        std::string name;
+        SystemFn fn;
+        SystemAffinity affinity = SystemAffinity::Any;
+        bool enabled = true;
+
+        std::vector<uint32_t> reads;
+        std::vector<uint32_t> writes;
+        std::vector<uint32_t> dependencies;
+        std::vector<uint32_t> dependents;
+        std::atomic<uint32_t> pendingDependencies{ 0 };
+
+        double startMs = 0.0;
+        double durationMs = 0.0;
+    };
+
+    std::string _name;
+    std::vector<std::unique_ptr<SystemNode>> _systems;
+    std::unordered_map<std::string, uint32_t> _resources;
+    bool _compiled = false;
+
+    // State of the Execute() in flight
+    ThreadPool* _pool = nullptr;
+    JobCounter* _jobs = nullptr;
+    const SystemFrameContext* _context = nullptr;
+    Clock::time_point _frameStart;
+    std::atomic<uint32_t> _remaining{ 0 };
+    std::mutex _callingQueueMutex;
+    std::vector<uint32_t> _callingQueue;
+
+    mutable std::mutex _reportMutex;
+    SystemGraphReport _lastReport;
+
+    uint32_t GetResourceID(std::string_view resource);
+    void InvokeSystem(SystemNode& system);
+    void RunSystem(uint32_t index);
+    void Dispatch(uint32_t index);
+    bool PopCallingThreadSystem(uint32_t& index);
+    void BuildReport(uint64_t frameIndex, double wallMs);
+};
+
+#endif // SYSTEM_GRAPH_H
@@ -0,0 +1,121 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "telemetry.h"
+
+namespace {
+    thread_local FrameTelemetry* t_currentTelemetry = nullptr;
+}
+
+FrameTelemetry::Scope::Scope(FrameTelemetry* telemetry)
+    : _previous(t_currentTelemetry) {
+    t_currentTelemetry = telemetry;
+}
+
+FrameTelemetry::Scope::~Scope() {
+    t_currentTelemetry = _previous;
+}
+
+FrameTelemetry* FrameTelemetry::GetCurrent() {
+    return t_currentTelemetry;
+}
+
+void FrameTelemetry::EndFrame(uint64_t frameIndex, float frameMs, float renderMs) {
+    FrameStats stats;
+    stats.frameIndex = frameIndex;
+    stats.drawCalls = _drawCalls.exchange(0, std::memory_order_relaxed);
+    stats.triangles = _triangles.exchange(0, std::memory_order_relaxed);
+    stats.uniformUploads = _uniformUploads.exchange(0, std::memory_order_relaxed);
+    stats.bufferUploads = _bufferUploads.exchange(0, std::memory_order_relaxed);
+    stats.bytesUploaded = _bytesUploaded.exchange(0, std::memory_order_relaxed);
+    stats.stateCallsIssued = _stateCallsIssued.exchange(0, std::memory_order_relaxed);
+    stats.stateCallsSkipped = _stateCallsSkipped.exchange(0, std::memory_order_relaxed);
+    stats.frameMs = frameMs;
+    stats.renderMs = renderMs;
+    stats.updateMs = _updateMs.load(std::memory_order_relaxed);
+    stats.scriptMs = _scriptMs.load(std::memory_order_relaxed);
+    stats.visibleObjects = _visibleObjects.exchange(0, std::memory_order_relaxed);
+    stats.culledObjects = _culledObjects.exchange(0, std::memory_order_relaxed);
+    stats.visibleShadowCasters = _visibleShadowCasters.exchange(0, std::memory_order_relaxed);
+    stats.culledShadowCasters = _culledShadowCasters.exchange(0, std::memory_order_relaxed);
+    stats.shadowLayersRebuilt = _shadowLayersRebuilt.exchange(0, std::memory_order_relaxed);
+    stats.shadowLayersCached = _shadowLayersCached.exchange(0, std::memory_order_relaxed);
+    stats.occludedObjects = _occludedObjects.exchange(0, std::memory_order_relaxed);
+    stats.occluders = _occluders.exchange(0, std::memory_order_relaxed);
+
+    const Words words = std::bit_cast<Words>(stats);
+
+    uint64_t frame = _written.load(std::memory_order_relaxed);
+    Slot& slot = _history[frame % HISTORY_SIZE];
+
+    // Odd sequence marks the slot as being written
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORDS; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    _written.store(frame + 1, std::memory_order_release);
+}
+
+bool FrameTelemetry::ReadSlot(uint64_t frame, FrameStats& out) const {
+    const Slot& slot = _history[frame % HISTORY_SIZE];
+    Words words;
+
+    // Every write to a slot advances its sequence by two, so the sequence
+    // also tells which lap of the ring the slot holds
+    const uint64_t expected = 2 * (frame / HISTORY_SIZE + 1);
+
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) continue;
+        if (before != expected) return false;
+
+        for (size_t i = 0; i < WORDS; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before) {
+            out = std::bit_cast<FrameStats>(words);
+            return true;
+        }
+    }
+
+    // Kept losing the race against the writer
+    return false;
+}
+
+bool FrameTelemetry::GetLatest(FrameStats& out) const {
+    uint64_t written = _written.load(std::memory_order_acquire);
+    if (written == 0) return false;
+    return ReadSlot(written - 1, out);
+}
+
+size_t FrameTelemetry::GetHistory(FrameStats* out, size_t maxCount) const {
+    if (!out || maxCount == 0) return 0;
+
+    uint64_t written = _written.load(std::memory_order_acquire);
+    uint64_t available = std::min<uint64_t>(written, HISTORY_SIZE - 1);
+    uint64_t count = std::min<uint64_t>(available, maxCount);
+
+    size_t copied = 0;
+    for (uint64_t frame = written - count; frame < written; ++frame) {
+        if (ReadSlot(frame, out[copied])) {
+            copied++;
+        }
+    }
+    return copied;
+}
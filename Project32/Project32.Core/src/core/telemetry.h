@@ -0,0 +1,192 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "../common.h"
+
+#include <bit>
+
+// One rendered frame of one engine. Same layout as P32FrameStats in the API.
+struct FrameStats {
+    uint64_t frameIndex = 0;
+    uint64_t drawCalls = 0;
+    uint64_t triangles = 0;
+    uint64_t uniformUploads = 0;
+    uint64_t bufferUploads = 0;
+    uint64_t bytesUploaded = 0;
+    uint64_t stateCallsIssued = 0;      // GL binds and state changes that reached the driver
+    uint64_t stateCallsSkipped = 0;     // redundant ones the state cache dropped
+    float frameMs = 0.0f;    // time since the previous rendered frame
+    float renderMs = 0.0f;
+    float updateMs = 0.0f;
+    float scriptMs = 0.0f;
+    uint32_t visibleObjects = 0;
+    uint32_t culledObjects = 0;
+    uint32_t visibleShadowCasters = 0;
+    uint32_t culledShadowCasters = 0;
+    uint32_t shadowLayersRebuilt = 0;   // static shadow depth re-rendered
+    uint32_t shadowLayersCached = 0;    // static shadow depth reused
+    uint32_t occludedObjects = 0;       // frustum visible but hidden by occluders
+    uint32_t occluders = 0;
+};
+
+// Per-engine frame counters plus a fixed-size history of finished frames.
+// Backends count into the telemetry bound to the calling thread (see Scope),
+// the history is a seqlocked ring so readers on any thread never block the
+// render thread.
+class FrameTelemetry {
+public:
+    static constexpr size_t HISTORY_SIZE = 256;
+
+    // Binds telemetry to the calling thread for the lifetime of the scope
+    class Scope {
+    private:
+        FrameTelemetry* _previous;
+
+    public:
+        explicit Scope(FrameTelemetry* telemetry);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    FrameTelemetry() = default;
+
+    FrameTelemetry(const FrameTelemetry&) = delete;
+    FrameTelemetry& operator=(const FrameTelemetry&) = delete;
+
+    static FrameTelemetry* GetCurrent();
+
+    void AddDrawCall(uint64_t triangles) {
+        _drawCalls.fetch_add(1, std::memory_order_relaxed);
+        _triangles.fetch_add(triangles, std::memory_order_relaxed);
+    }
+    void AddUniformUploads(uint64_t count = 1) { _uniformUploads.fetch_add(count, std::memory_order_relaxed); }
+    void AddBufferUpload(uint64_t bytes) {
+        _bufferUploads.fetch_add(1, std::memory_order_relaxed);
+        _bytesUploaded.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void AddCulling(uint32_t visible, uint32_t culled, uint32_t shadowVisible, uint32_t shadowCulled) {
+        _visibleObjects.fetch_add(visible, std::memory_order_relaxed);
+        _culledObjects.fetch_add(culled, std::memory_order_relaxed);
+        _visibleShadowCasters.fetch_add(shadowVisible, std::memory_order_relaxed);
+        _culledShadowCasters.fetch_add(shadowCulled, std::memory_order_relaxed);
+    }
+
+    void AddShadowCache(uint32_t rebuilt, uint32_t cached) {
+        _shadowLayersRebuilt.fetch_add(rebuilt, std::memory_order_relaxed);
+        _shadowLayersCached.fetch_add(cached, std::memory_order_relaxed);
+    }
+
+    void AddOcclusion(uint32_t occluded, uint32_t occluders) {
+        _occludedObjects.fetch_add(occluded, std::memory_order_relaxed);
+        _occluders.fetch_add(occluders, std::memory_order_relaxed);
+    }
+
+    void AddStateCalls(uint64_t issued, uint64_t skipped) {
+        _stateCallsIssued.fetch_add(issued, std::memory_order_relaxed);
+        _stateCallsSkipped.fetch_add(skipped, std::memory_order_relaxed);
+    }
+
+    // Written by the update thread, picked up by the next EndFrame()
+    void SetUpdateTimes(float updateMs, float scriptMs) {
+        _updateMs.store(updateMs, std::memory_order_relaxed);
+        _scriptMs.store(scriptMs, std::memory_order_relaxed);
+    }
+
+    // Closes the frame in flight and appends it to the history. Only one
+    // thread may end frames at a time.
+    void EndFrame(uint64_t frameIndex, float frameMs, float renderMs);
+
+    bool GetLatest(FrameStats& out) const;
+
+    // Copies up to maxCount of the newest frames, oldest first
+    size_t GetHistory(FrameStats* out, size_t maxCount) const;
+
+    uint64_t GetRecordedFrames() const { return _written.load(std::memory_order_acquire); }
+
+private:
+    static constexpr size_t WORDS = sizeof(FrameStats) / sizeof(uint64_t);
+    static_assert(sizeof(FrameStats) % sizeof(uint64_t) == 0, "FrameStats must pack into whole words");
+    static_assert(std::is_trivially_copyable_v<FrameStats>, "FrameStats is bit_cast through the history slots");
+
+    using Words = std::array<uint64_t, WORDS>;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{ 0 };
+        std::array<std::atomic<uint64_t>, WORDS> words{};
+    };
+
+    std::atomic<uint64_t> _drawCalls{ 0 };
+    std::atomic<uint64_t> _triangles{ 0 };
+    std::atomic<uint64_t> _uniformUploads{ 0 };
+    std::atomic<uint64_t> _bufferUploads{ 0 };
+    std::atomic<uint64_t> _bytesUploaded{ 0 };
+    std::atomic<uint64_t> _stateCallsIssued{ 0 };
+    std::atomic<uint64_t> _stateCallsSkipped{ 0 };
+    std::atomic<uint32_t> _visibleObjects{ 0 };
+    std::atomic<uint32_t> _culledObjects{ 0 };
+    std::atomic<uint32_t> _visibleShadowCasters{ 0 };
+    std::atomic<uint32_t> _culledShadowCasters{ 0 };
+    std::atomic<uint32_t> _shadowLayersRebuilt{ 0 };
+    std::atomic<uint32_t> _shadowLayersCached{ 0 };
+    std::atomic<uint32_t> _occludedObjects{ 0 };
+    std::atomic<uint32_t> _occluders{ 0 };
+    std::atomic<float> _updateMs{ 0.0f };
+    std::atomic<float> _scriptMs{ 0.0f };
+
+    std::array<Slot, HISTORY_SIZE> _history;
+    std::atomic<uint64_t> _written{ 0 };
+
+    bool ReadSlot(uint64_t frame, FrameStats& out) const;
+};
+
+// Counter hooks for backends and GPU resource wrappers, no-ops when the
+// calling thread is not rendering for an engine
+namespace Telemetry {
+    inline void CountDrawCall(uint64_t triangles) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddDrawCall(triangles);
+    }
+
+    inline void CountUniformUpload(uint64_t count = 1) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddUniformUploads(count);
+    }
+
+    inline void CountBufferUpload(uint64_t bytes) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddBufferUpload(bytes);
+    }
+
+    inline void CountCulling(uint32_t visible, uint32_t culled, uint32_t shadowVisible, uint32_t shadowCulled) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) {
+            telemetry->AddCulling(visible, culled, shadowVisible, shadowCulled);
+        }
+    }
+
+    inline void CountShadowCache(uint32_t rebuilt, uint32_t cached) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddShadowCache(rebuilt, cached);
+    }
+
+    inline void CountOcclusion(uint32_t occluded, uint32_t occluders) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddOcclusion(occluded, occluders);
+    }
+
+    inline void CountStateCalls(uint64_t issued, uint64_t skipped) {
+        if (FrameTelemetry* telemetry = FrameTelemetry::GetCurrent()) telemetry->AddStateCalls(issued, skipped);
+    }
+}
+
+#endif // TELEMETRY_H
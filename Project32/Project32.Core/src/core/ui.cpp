@@ -133,6 +133,11 @@ void UIX::EndImgui() {
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
+std::recursive_mutex& UIX::GetSharedMutex() {
+    static std::recursive_mutex s_mutex;
+    return s_mutex;
+}
+
 bool UIX::IsInitialized() const {
     return _imguiInitialized && _imguiContext != nullptr;
 }
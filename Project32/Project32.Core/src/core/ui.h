@@ -66,6 +66,11 @@ public:
 
 	bool IsInitialized() const;
 	ImGuiContext* GetContext() const;
+
+	// Dear ImGui keeps the current context in a global and the GLFW backend
+	// feeds input from the main thread, so with threaded rendering every
+	// ImGui touch (frames, event pumping) has to hold this lock.
+	static std::recursive_mutex& GetSharedMutex();
 };
 
 #endif // UI_H
\ No newline at end of file
@@ -13,8 +13,12 @@
 #include "window.h"
 #include "../renderer/renderer.h"
 #include "context_guard.h"
+#include "engine.h"
+#include "../BackEnd/OpenGL/GL_state_cache.h"
 
 int Window::_nextID = 0;
+std::mutex Window::s_contextsMutex;
+std::vector<GLFWwindow*> Window::s_contexts;
 
 static void StaticFramebufferSizeCallback(GLFWwindow* glfwWindow, int width, int height) {
     Window* window = static_cast<Window*>(glfwGetWindowUserPointer(glfwWindow));
@@ -23,6 +27,20 @@ static void StaticFramebufferSizeCallback(GLFWwindow* glfwWindow, int width, int
     }
 }
 
+static void StaticWindowFocusCallback(GLFWwindow* glfwWindow, int focused) {
+    Window* window = static_cast<Window*>(glfwGetWindowUserPointer(glfwWindow));
+    if (window) {
+        window->OnFocusChanged(focused == GLFW_TRUE);
+    }
+}
+
+static void StaticWindowIconifyCallback(GLFWwindow* glfwWindow, int iconified) {
+    Window* window = static_cast<Window*>(glfwGetWindowUserPointer(glfwWindow));
+    if (window) {
+        window->OnIconifyChanged(iconified == GLFW_TRUE);
+    }
+}
+
 Window::Window(int width, int height, const std::string& title, GLFWwindow* shareContext, Engine* engine)
     : _width(width), _height(height), _title(title), _ID(_nextID++), _engine(engine)
 {
@@ -42,6 +60,11 @@ Window::Window(int width, int height, const std::string& title, GLFWwindow* shar
         spdlog::info("[Window {}] GLFW initialized successfully", _ID);
     }
 
+    if (GraphicsBackend::IsHeadless()) {
+        InitHeadless();
+        return;
+    }
+
     if (GraphicsBackend::GetCurrentType() == BackendType::OPENGL) {
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
@@ -59,7 +82,13 @@ Window::Window(int width, int height, const std::string& title, GLFWwindow* shar
         glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
     }
 
-    _window = glfwCreateWindow(width, height, title.c_str(), nullptr, shareContext);
+    {
+        std::lock_guard<std::mutex> lock(s_contextsMutex);
+        if (!shareContext && !s_contexts.empty()) shareContext = s_contexts.front();
+
+        _window = glfwCreateWindow(width, height, title.c_str(), nullptr, shareContext);
+        if (_window) s_contexts.push_back(_window);
+    }
     if (!_window) {
         spdlog::error("[Window {}] Failed to create GLFW window", _ID);
         throw std::runtime_error("Failed to create GLFW window");
@@ -68,8 +97,18 @@ Window::Window(int width, int height, const std::string& title, GLFWwindow* shar
     spdlog::info("[Window {}] GLFW window created at: {}", _ID, static_cast<void*>(_window));
 
     glfwSetWindowUserPointer(_window, this);
+    _stateCache = std::make_unique<GLStateCache>();
+    if (!_stateCache->AcquireContextSlot()) {
+        throw std::runtime_error("Too many open windows, no context slot left for Window " + std::to_string(_ID));
+    }
     glfwSetFramebufferSizeCallback(_window, StaticFramebufferSizeCallback);
 
+    // Installed before ImGui so its GLFW backend chains to these
+    glfwSetWindowFocusCallback(_window, StaticWindowFocusCallback);
+    glfwSetWindowIconifyCallback(_window, StaticWindowIconifyCallback);
+    _focused.store(glfwGetWindowAttrib(_window, GLFW_FOCUSED) == GLFW_TRUE);
+    _iconified.store(glfwGetWindowAttrib(_window, GLFW_ICONIFIED) == GLFW_TRUE);
+
     MakeContextCurrent();
     glfwSetInputMode(_window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
@@ -136,14 +175,38 @@ Window::~Window() {
         _ui.reset();
     }
 
-    if (_window) {
-        glfwDestroyWindow(_window);
-        _window = nullptr;
-    }
+    DestroyContext();
 
     spdlog::info("[Window {}] Destructor completed", _ID);
 }
 
+void Window::DestroyContext() {
+    if (!_window) return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_contextsMutex);
+        s_contexts.erase(std::remove(s_contexts.begin(), s_contexts.end(), _window), s_contexts.end());
+    }
+    glfwDestroyWindow(_window);
+    _window = nullptr;
+
+    // Frees the context slot, vertex arrays of the context went with it
+    _stateCache.reset();
+}
+
+void Window::InitHeadless() {
+    // No GLFW window, context or ImGui, the renderer only talks to the null backend
+    _headless = true;
+    _isOpen = true;
+
+    _input = std::make_unique<Input>(this);
+
+    _renderer = std::make_unique<Renderer>(this);
+    _renderer->Init();
+
+    spdlog::info("[Window {}] Created headless {}x{}", _ID, _width.load(), _height.load());
+}
+
 void Window::Init() {
     spdlog::info("[Window {}] Init() called (initialization already done in constructor)", _ID);
 }
@@ -179,20 +242,32 @@ void Window::Shutdown() {
         _ui.reset();
     }
 
-    if (_window) {
-        glfwDestroyWindow(_window);
-        _window = nullptr;
-    }
+    DestroyContext();
 
     spdlog::info("[Window {}] Shutdown complete", _ID);
 }
 
 void Window::Render() {
-    if (!_window || !_renderer || !_renderer->IsReady()) {
+    if (!_renderer || !_renderer->IsReady()) {
+        return;
+    }
+
+    if (_headless) {
+        _renderer->RenderFrame();
+        return;
+    }
+
+    if (!_window) {
         return;
     }
 
     ContextGuard guard(this);
+
+    // Swap interval is context state, apply it on whichever thread renders
+    if (_vsyncDirty.exchange(false)) {
+        glfwSwapInterval(_vsync ? 1 : 0);
+    }
+
     _renderer->RenderFrame();
     SwapBuffers();
 }
@@ -220,10 +295,16 @@ void Window::SwapBuffers() {
 }
 
 bool Window::IsOpen() const {
+    if (_headless) return _isOpen;
     return _window && _isOpen && !glfwWindowShouldClose(_window);
 }
 
 void Window::SetShouldClose(bool value) {
+    if (_headless) {
+        _isOpen = !value;
+        return;
+    }
+
     if (_window) {
         glfwSetWindowShouldClose(_window, value);
         if (value) {
@@ -280,9 +361,13 @@ void Window::SetPosition(int x, int y) {
 
 void Window::SetVSync(bool enabled) {
     _vsync = enabled;
-    if (_window) {
-        ContextGuard guard(this);
+    if (_window && glfwGetCurrentContext() == _window) {
         glfwSwapInterval(enabled ? 1 : 0);
+        _vsyncDirty.store(false);
+    }
+    else {
+        // Our context may be current on a render thread, defer to Render()
+        _vsyncDirty.store(true);
     }
 }
 
@@ -325,6 +410,7 @@ void Window::MakeContextCurrent() {
     }
 
     if (_ui && _ui->IsInitialized()) {
+        std::lock_guard<std::recursive_mutex> uiLock(UIX::GetSharedMutex());
         ImGui::SetCurrentContext(_ui->GetContext());
     }
 }
@@ -400,7 +486,10 @@ void Window::OnFramebufferResize(int width, int height) {
     _width = width;
     _height = height;
 
-    if (_window) {
+    // With a render thread owning the context the renderer picks the new size
+    // up on its next frame, the context can not be made current here
+    bool renderThreadOwned = _engine && _engine->IsRenderThreadActive();
+    if (_window && !renderThreadOwned) {
         ContextGuard guard(this);
         GraphicsBackend::Get()->SetViewport(0, 0, width, height);
     }
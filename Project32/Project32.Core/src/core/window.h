@@ -23,6 +23,7 @@ struct ImGuiContext;
 class Renderer;
 class UIX;
 class Input;
+class GLStateCache;
 
 enum class CursorMode {
     Normal,
@@ -38,14 +39,28 @@ private:
     std::unique_ptr<Renderer> _renderer;
     std::unique_ptr<Input> _input;
 
-    int _width;
-    int _height;
+    // GL state shadow of this window's context, none when headless
+    std::unique_ptr<GLStateCache> _stateCache;
+
+    // Open engine contexts, a new window shares objects with the first one
+    // so meshes, textures and shaders load once per process
+    static std::mutex s_contextsMutex;
+    static std::vector<GLFWwindow*> s_contexts;
+
+    // Written by the resize callback on the main thread, read by the
+    // renderer which may live on an engine render thread
+    std::atomic<int> _width;
+    std::atomic<int> _height;
 
     std::string _title;
     std::string _iconPath;
     bool _vsync = true;
+    std::atomic<bool> _vsyncDirty{ false };
+    std::atomic<bool> _focused{ true };
+    std::atomic<bool> _iconified{ false };
     bool _isOpen = false;
     bool _isFullscreen = false;
+    bool _headless = false;
     static int _nextID;
     int _ID;
 
@@ -61,6 +76,9 @@ private:
     ImGuiContext* _imguiContext = nullptr;
     bool _imguiInitialized = false;
 
+    void InitHeadless();
+    void DestroyContext();
+
 public:
     Window(int width, int height, const std::string& title, GLFWwindow* shareContext, Engine* engine = nullptr);
     ~Window();
@@ -80,6 +98,7 @@ public:
     void SwapBuffers();
     void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f);
     void MakeContextCurrent();
+    GLStateCache* GetStateCache() const { return _stateCache.get(); }
 
     bool IsOpen() const;
     void SetShouldClose(bool value);
@@ -118,6 +137,9 @@ public:
 
     static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
 
+    void OnFocusChanged(bool focused) { _focused.store(focused); }
+    void OnIconifyChanged(bool iconified) { _iconified.store(iconified); }
+
     Renderer* GetRenderer() const;
     UIX* GetUI() const;
     Input* GetInput() const;
@@ -129,8 +151,11 @@ public:
     const std::string& GetTitle() const { return _title; }
     bool IsVSync() const { return _vsync; }
     bool IsFullscreen() const { return _isFullscreen; }
+    bool IsFocused() const { return _focused.load(); }
+    bool IsIconified() const { return _iconified.load(); }
     bool WindowIsOpen() const { return _window != nullptr && _isOpen; }
     bool IsWindowValid() const { return _window != nullptr; }
+    bool IsHeadless() const { return _headless; }
     CursorMode GetCursorMode() const { return _cursorMode; }
 
     ImGuiContext* GetImGuiContext() const { return _imguiContext; }
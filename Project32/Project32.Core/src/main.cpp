@@ -12,6 +12,8 @@
 #include "common.h"
 #include "core/engine.h"
 #include "core/window.h"
+#include "core/telemetry.h"
+#include "BackEnd/Null/Null_backEnd.h"
 
 extern "C" {
     static int g_currentEngineID = -1;
@@ -93,6 +95,44 @@ extern "C" {
         }
     }
 
+    __declspec(dllexport) void SetThreadedRendering(bool enabled) {
+        EngineManager::Instance()->SetThreadedRendering(enabled);
+    }
+
+    __declspec(dllexport) bool IsThreadedRendering() {
+        return EngineManager::Instance()->IsThreadedRendering();
+    }
+
+    __declspec(dllexport) bool EnableNullBackend() {
+        BackendType current = GraphicsBackend::GetCurrentType();
+        if (current == BackendType::Null) return true;
+
+        if (current != BackendType::UNDEFINED) {
+            spdlog::warn("[EnableNullBackend] A graphics backend is already running, create engines after enabling");
+            return false;
+        }
+
+        if (!GraphicsBackend::Initialize(BackendType::Null)) {
+            return false;
+        }
+        GraphicsTypes::Initialize();
+        return true;
+    }
+
+    __declspec(dllexport) bool GetNullBackendStats(NullBackendStats* stats) {
+        if (!stats || !GraphicsBackend::IsHeadless()) return false;
+
+        auto* backend = static_cast<NullBackend*>(GraphicsBackend::Get());
+        *stats = backend->GetStats();
+        return true;
+    }
+
+    __declspec(dllexport) void ResetNullBackendStats() {
+        if (GraphicsBackend::IsHeadless()) {
+            static_cast<NullBackend*>(GraphicsBackend::Get())->ResetStats();
+        }
+    }
+
     __declspec(dllexport) bool IsEngineRunning(int engineID) {
         Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
         return engine && engine->IsRunning();
@@ -271,6 +311,37 @@ extern "C" {
         if (window) {}
     }
 
+    __declspec(dllexport) void SetEngineTargetFPS(int engineID, float fps) {
+        Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
+        if (engine) {
+            engine->SetTargetFPS(fps);
+        }
+    }
+
+    __declspec(dllexport) float GetEngineTargetFPS(int engineID) {
+        Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
+        return engine ? engine->GetTargetFPS() : 0.0f;
+    }
+
+    __declspec(dllexport) void SetEngineBackgroundFPS(int engineID, float fps) {
+        Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
+        if (engine) {
+            engine->SetBackgroundFPS(fps);
+        }
+    }
+
+    __declspec(dllexport) bool GetEngineFrameStats(int engineID, FrameStats* stats) {
+        Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
+        if (!engine || !stats) return false;
+        return engine->GetTelemetry().GetLatest(*stats);
+    }
+
+    __declspec(dllexport) int GetEngineFrameStatsHistory(int engineID, FrameStats* stats, int maxCount) {
+        Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
+        if (!engine || !stats || maxCount <= 0) return 0;
+        return static_cast<int>(engine->GetTelemetry().GetHistory(stats, static_cast<size_t>(maxCount)));
+    }
+
     __declspec(dllexport) void ToggleEngineRenderScene(int engineID) {
         Engine* engine = EngineManager::Instance()->GetEngineByID(engineID);
         if (!engine) return;
@@ -0,0 +1,138 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "command_buffer.h"
+
+namespace {
+    template<typename T>
+    T ReadPacket(const uint8_t* data) {
+        T packet;
+        std::memcpy(&packet, data, sizeof(T));
+        return packet;
+    }
+}
+
+void CommandBuffer::Draw(const Mesh& mesh) {
+    if (!mesh.IsValid()) return;
+
+    if (mesh.IsIndexed()) {
+        DrawIndexed(mesh.GetVAO(m_contextSlot), mesh.GetIndexCount());
+    }
+    else {
+        DrawArrays(mesh.GetVAO(m_contextSlot), mesh.GetVertexCount());
+    }
+}
+
+void CommandBuffer::DrawInstanced(const Mesh& mesh, unsigned int instanceCount, unsigned int baseInstance) {
+    if (!mesh.IsValid() || instanceCount == 0) return;
+
+    if (mesh.IsIndexed()) {
+        DrawIndexedInstanced(mesh.GetVAO(m_contextSlot), mesh.GetIndexCount(), instanceCount, baseInstance);
+    }
+    else {
+        DrawArraysInstanced(mesh.GetVAO(m_contextSlot), mesh.GetVertexCount(), instanceCount, baseInstance);
+    }
+}
+
+void CommandBuffer::Execute(IGraphicsBackend& backend, const CommandReplayContext& context) const {
+    const uint8_t* cursor = m_data.data();
+    const uint8_t* end = cursor + m_data.size();
+
+    while (cursor < end) {
+        RenderCommands::CommandHeader header = ReadPacket<RenderCommands::CommandHeader>(cursor);
+        const uint8_t* payload = cursor + sizeof(RenderCommands::CommandHeader);
+
+        switch (header.type) {
+        case RenderCommandType::BindShader: {
+            auto cmd = ReadPacket<RenderCommands::BindShader>(payload);
+            backend.BindShader(cmd.shaderID);
+            break;
+        }
+        case RenderCommandType::SetUniformMat4: {
+            auto cmd = ReadPacket<RenderCommands::SetUniformMat4>(payload);
+            backend.SetUniformMat4(cmd.location, cmd.value);
+            break;
+        }
+        case RenderCommandType::SetUniformVec3: {
+            auto cmd = ReadPacket<RenderCommands::SetUniformVec3>(payload);
+            backend.SetUniformVec3(cmd.location, cmd.value);
+            break;
+        }
+        case RenderCommandType::SetUniformFloat: {
+            auto cmd = ReadPacket<RenderCommands::SetUniformFloat>(payload);
+            backend.SetUniformFloat(cmd.location, cmd.value);
+            break;
+        }
+        case RenderCommandType::SetUniformInt: {
+            auto cmd = ReadPacket<RenderCommands::SetUniformInt>(payload);
+            backend.SetUniformInt(cmd.location, cmd.value);
+            break;
+        }
+        case RenderCommandType::BindTexture: {
+            auto cmd = ReadPacket<RenderCommands::BindTexture>(payload);
+            backend.BindTexture(cmd.textureID, cmd.slot);
+            break;
+        }
+        case RenderCommandType::SetViewport: {
+            auto cmd = ReadPacket<RenderCommands::SetViewport>(payload);
+            backend.SetViewport(cmd.x, cmd.y, cmd.width, cmd.height);
+            break;
+        }
+        case RenderCommandType::Clear: {
+            auto cmd = ReadPacket<RenderCommands::Clear>(payload);
+            backend.Clear(cmd.color);
+            break;
+        }
+        case RenderCommandType::SetState: {
+            auto cmd = ReadPacket<RenderCommands::SetState>(payload);
+            switch (cmd.state) {
+            case RenderState::DepthTest: backend.SetDepthTest(cmd.enabled); break;
+            case RenderState::CullFace: backend.SetCullFace(cmd.enabled); break;
+            case RenderState::Wireframe: backend.SetWireframe(cmd.enabled); break;
+            case RenderState::Blending: backend.SetBlending(cmd.enabled); break;
+            }
+            break;
+        }
+        case RenderCommandType::DrawIndexed: {
+            auto cmd = ReadPacket<RenderCommands::DrawIndexed>(payload);
+            backend.DrawIndexed(cmd.vao, cmd.indexCount);
+            break;
+        }
+        case RenderCommandType::DrawArrays: {
+            auto cmd = ReadPacket<RenderCommands::DrawArrays>(payload);
+            backend.DrawArrays(cmd.vao, cmd.vertexCount);
+            break;
+        }
+        case RenderCommandType::DrawIndexedInstanced: {
+            auto cmd = ReadPacket<RenderCommands::DrawIndexedInstanced>(payload);
+            backend.DrawIndexedInstanced(cmd.vao, cmd.indexCount, cmd.instanceCount, cmd.baseInstance + context.instanceOffset);
+            break;
+        }
+        case RenderCommandType::DrawArraysInstanced: {
+            auto cmd = ReadPacket<RenderCommands::DrawArraysInstanced>(payload);
+            backend.DrawArraysInstanced(cmd.vao, cmd.vertexCount, cmd.instanceCount, cmd.baseInstance + context.instanceOffset);
+            break;
+        }
+        case RenderCommandType::MultiDrawIndexedIndirect: {
+            auto cmd = ReadPacket<RenderCommands::MultiDrawIndexedIndirect>(payload);
+            size_t offset = context.indirectOffset + static_cast<size_t>(cmd.firstCommand) * sizeof(IndirectDrawCommand);
+            backend.MultiDrawIndexedIndirect(cmd.vao, context.indirectBuffer, offset, cmd.drawCount, cmd.triangleCount);
+            break;
+        }
+        default:
+            spdlog::error("[CommandBuffer::Execute] Unknown command type {}", static_cast<int>(header.type));
+            return;
+        }
+
+        cursor = payload + header.size;
+    }
+}
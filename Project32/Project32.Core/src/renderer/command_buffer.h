@@ -0,0 +1,159 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include "../common.h"
+
+class Mesh;
+class IGraphicsBackend;
+
+enum class RenderCommandType : uint8_t {
+    BindShader,
+    SetUniformMat4,
+    SetUniformVec3,
+    SetUniformFloat,
+    SetUniformInt,
+    BindTexture,
+    SetViewport,
+    Clear,
+    SetState,
+    DrawIndexed,
+    DrawArrays,
+    DrawIndexedInstanced,
+    DrawArraysInstanced,
+    MultiDrawIndexedIndirect
+};
+
+enum class RenderState : uint8_t {
+    DepthTest,
+    CullFace,
+    Wireframe,
+    Blending
+};
+
+// Packet layouts. Each one is stored right after a CommandHeader.
+namespace RenderCommands {
+    struct CommandHeader {
+        RenderCommandType type;
+        uint16_t size;
+    };
+
+    struct BindShader { static constexpr RenderCommandType TYPE = RenderCommandType::BindShader; int shaderID; };
+    struct SetUniformMat4 { static constexpr RenderCommandType TYPE = RenderCommandType::SetUniformMat4; int location; glm::mat4 value; };
+    struct SetUniformVec3 { static constexpr RenderCommandType TYPE = RenderCommandType::SetUniformVec3; int location; glm::vec3 value; };
+    struct SetUniformFloat { static constexpr RenderCommandType TYPE = RenderCommandType::SetUniformFloat; int location; float value; };
+    struct SetUniformInt { static constexpr RenderCommandType TYPE = RenderCommandType::SetUniformInt; int location; int value; };
+    struct BindTexture { static constexpr RenderCommandType TYPE = RenderCommandType::BindTexture; unsigned int textureID; int slot; };
+    struct SetViewport { static constexpr RenderCommandType TYPE = RenderCommandType::SetViewport; int x, y, width, height; };
+    struct Clear { static constexpr RenderCommandType TYPE = RenderCommandType::Clear; glm::vec4 color; };
+    struct SetState { static constexpr RenderCommandType TYPE = RenderCommandType::SetState; RenderState state; bool enabled; };
+    struct DrawIndexed { static constexpr RenderCommandType TYPE = RenderCommandType::DrawIndexed; unsigned int vao, indexCount; };
+    struct DrawArrays { static constexpr RenderCommandType TYPE = RenderCommandType::DrawArrays; unsigned int vao, vertexCount; };
+    struct DrawIndexedInstanced { static constexpr RenderCommandType TYPE = RenderCommandType::DrawIndexedInstanced; unsigned int vao, indexCount, instanceCount, baseInstance; };
+    struct DrawArraysInstanced { static constexpr RenderCommandType TYPE = RenderCommandType::DrawArraysInstanced; unsigned int vao, vertexCount, instanceCount, baseInstance; };
+    struct MultiDrawIndexedIndirect { static constexpr RenderCommandType TYPE = RenderCommandType::MultiDrawIndexedIndirect; unsigned int vao, firstCommand, drawCount; uint64_t triangleCount; };
+}
+
+// Where this frame's streamed data ended up, resolved at replay so recorded
+// commands stay valid when the data moves between stream buffer regions
+struct CommandReplayContext {
+    unsigned int instanceOffset = 0;    // added to the base instance of instanced draws
+    unsigned int indirectBuffer = 0;
+    size_t indirectOffset = 0;          // byte offset of indirect command 0
+};
+
+// Backend agnostic list of render commands packed into one linear buffer.
+// Recording needs no graphics context, so any thread can fill one. Replay
+// happens on the thread that owns the backend. Uniforms are addressed by
+// location, resolve them on the context thread before recording. Mesh
+// draws take the vertex arrays of the context slot replaying the buffer,
+// prepared with Mesh::PrepareContext.
+class CommandBuffer {
+private:
+    std::vector<uint8_t> m_data;
+    size_t m_commandCount = 0;
+    uint32_t m_contextSlot = 0;
+
+    template<typename T>
+    void Push(const T& packet) {
+        static_assert(std::is_trivially_copyable_v<T>, "Render commands must be trivially copyable");
+
+        RenderCommands::CommandHeader header{ T::TYPE, static_cast<uint16_t>(sizeof(T)) };
+        size_t offset = m_data.size();
+        m_data.resize(offset + sizeof(header) + sizeof(T));
+        std::memcpy(m_data.data() + offset, &header, sizeof(header));
+        std::memcpy(m_data.data() + offset + sizeof(header), &packet, sizeof(T));
+        ++m_commandCount;
+    }
+
+public:
+    CommandBuffer() = default;
+
+    // Keeps the allocation, steady-state frames record without allocating
+    void Reset() {
+        m_data.clear();
+        m_commandCount = 0;
+    }
+
+    void Reserve(size_t bytes) { m_data.reserve(bytes); }
+
+    void SetContextSlot(uint32_t slot) { m_contextSlot = slot; }
+
+    void BindShader(int shaderID) { Push(RenderCommands::BindShader{ shaderID }); }
+
+    void SetUniformMat4(int location, const glm::mat4& value) {
+        if (location != -1) Push(RenderCommands::SetUniformMat4{ location, value });
+    }
+    void SetUniformVec3(int location, const glm::vec3& value) {
+        if (location != -1) Push(RenderCommands::SetUniformVec3{ location, value });
+    }
+    void SetUniformFloat(int location, float value) {
+        if (location != -1) Push(RenderCommands::SetUniformFloat{ location, value });
+    }
+    void SetUniformInt(int location, int value) {
+        if (location != -1) Push(RenderCommands::SetUniformInt{ location, value });
+    }
+
+    void BindTexture(unsigned int textureID, int slot = 0) { Push(RenderCommands::BindTexture{ textureID, slot }); }
+    void SetViewport(int x, int y, int width, int height) { Push(RenderCommands::SetViewport{ x, y, width, height }); }
+    void Clear(const glm::vec4& color) { Push(RenderCommands::Clear{ color }); }
+    void SetState(RenderState state, bool enabled) { Push(RenderCommands::SetState{ state, enabled }); }
+
+    void DrawIndexed(unsigned int vao, unsigned int indexCount) { Push(RenderCommands::DrawIndexed{ vao, indexCount }); }
+    void DrawArrays(unsigned int vao, unsigned int vertexCount) { Push(RenderCommands::DrawArrays{ vao, vertexCount }); }
+    void DrawIndexedInstanced(unsigned int vao, unsigned int indexCount, unsigned int instanceCount, unsigned int baseInstance = 0) {
+        Push(RenderCommands::DrawIndexedInstanced{ vao, indexCount, instanceCount, baseInstance });
+    }
+    void DrawArraysInstanced(unsigned int vao, unsigned int vertexCount, unsigned int instanceCount, unsigned int baseInstance = 0) {
+        Push(RenderCommands::DrawArraysInstanced{ vao, vertexCount, instanceCount, baseInstance });
+    }
+    // firstCommand indexes the frame's indirect command array, see CommandReplayContext
+    void MultiDrawIndexedIndirect(unsigned int vao, unsigned int firstCommand, unsigned int drawCount, uint64_t triangleCount) {
+        Push(RenderCommands::MultiDrawIndexedIndirect{ vao, firstCommand, drawCount, triangleCount });
+    }
+
+    // Records the right draw for the mesh, does nothing for invalid meshes
+    void Draw(const Mesh& mesh);
+    void DrawInstanced(const Mesh& mesh, unsigned int instanceCount, unsigned int baseInstance = 0);
+
+    // Replays every command in recording order
+    void Execute(IGraphicsBackend& backend, const CommandReplayContext& context = {}) const;
+
+    bool IsEmpty() const { return m_commandCount == 0; }
+    size_t GetCommandCount() const { return m_commandCount; }
+    size_t GetSizeBytes() const { return m_data.size(); }
+};
+
+#endif // COMMAND_BUFFER_H
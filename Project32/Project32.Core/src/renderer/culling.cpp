@@ -0,0 +1,228 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "culling.h"
+#include "../core/job_system.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CULLING_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CULLING_TARGET_AVX
+#else
+#include <cpuid.h>
+#define CULLING_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+namespace {
+    using PlaneArray = std::array<glm::vec4, 6>;
+
+    std::atomic<int> s_pathOverride{ -1 };
+
+    void CullScalar(const PlaneArray& planes, const CullingBounds& bounds,
+        size_t first, size_t last, std::vector<uint32_t>& out) {
+        for (size_t i = first; i < last; ++i) {
+            bool inside = true;
+            for (const glm::vec4& plane : planes) {
+                float distance = plane.x * bounds.centerX[i] + plane.y * bounds.centerY[i]
+                    + plane.z * bounds.centerZ[i] + plane.w;
+                if (distance < -bounds.radius[i]) {
+                    inside = false;
+                    break;
+                }
+            }
+            if (inside) out.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // Turns a lane mask into indices, lowest lane first
+    inline void EmitMask(uint32_t mask, size_t base, std::vector<uint32_t>& out) {
+        while (mask) {
+            unsigned long lane;
+#if defined(_MSC_VER)
+            _BitScanForward(&lane, mask);
+#else
+            lane = static_cast<unsigned long>(__builtin_ctz(mask));
+#endif
+            out.push_back(static_cast<uint32_t>(base + lane));
+            mask &= mask - 1;
+        }
+    }
+
+#if defined(CULLING_X86)
+    void CullSSE(const PlaneArray& planes, const CullingBounds& bounds,
+        size_t first, size_t last, std::vector<uint32_t>& out) {
+        const __m128 zero = _mm_setzero_ps();
+
+        for (size_t i = first; i < last; i += 4) {
+            __m128 cx = _mm_loadu_ps(&bounds.centerX[i]);
+            __m128 cy = _mm_loadu_ps(&bounds.centerY[i]);
+            __m128 cz = _mm_loadu_ps(&bounds.centerZ[i]);
+            __m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(&bounds.radius[i]));
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const glm::vec4& plane : planes) {
+                __m128 distance = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane.x)), _mm_mul_ps(cy, _mm_set1_ps(plane.y))),
+                    _mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+            }
+
+            EmitMask(static_cast<uint32_t>(_mm_movemask_ps(inside)), i, out);
+        }
+    }
+
+    CULLING_TARGET_AVX void CullAVX(const PlaneArray& planes, const CullingBounds& bounds,
+        size_t first, size_t last, std::vector<uint32_t>& out) {
+        const __m256 zero = _mm256_setzero_ps();
+
+        for (size_t i = first; i < last; i += 8) {
+            __m256 cx = _mm256_loadu_ps(&bounds.centerX[i]);
+            __m256 cy = _mm256_loadu_ps(&bounds.centerY[i]);
+            __m256 cz = _mm256_loadu_ps(&bounds.centerZ[i]);
+            __m256 negRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(&bounds.radius[i]));
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (const glm::vec4& plane : planes) {
+                __m256 distance = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(cx, _mm256_set1_ps(plane.x)), _mm256_mul_ps(cy, _mm256_set1_ps(plane.y))),
+                    _mm256_add_ps(_mm256_mul_ps(cz, _mm256_set1_ps(plane.z)), _mm256_set1_ps(plane.w)));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+            }
+
+            EmitMask(static_cast<uint32_t>(_mm256_movemask_ps(inside)), i, out);
+        }
+    }
+
+    bool CpuSupportsAVX() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        // The OS must also save the YMM registers on context switches
+        return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+        return __builtin_cpu_supports("avx");
+#endif
+    }
+#endif
+
+    CullingPath DetectPath() {
+#if defined(CULLING_X86)
+        return CpuSupportsAVX() ? CullingPath::AVX : CullingPath::SSE;
+#else
+        return CullingPath::Scalar;
+#endif
+    }
+}
+
+void CullingBounds::Resize(size_t count) {
+    _count = count;
+    size_t padded = (count + LANE_PADDING - 1) / LANE_PADDING * LANE_PADDING;
+
+    centerX.resize(padded);
+    centerY.resize(padded);
+    centerZ.resize(padded);
+    radius.resize(padded);
+
+    // A radius of -inf puts the padding outside of every plane
+    for (size_t i = count; i < padded; ++i) {
+        Set(i, glm::vec3(0.0f), -std::numeric_limits<float>::infinity());
+    }
+}
+
+CullingPath FrustumCuller::GetActivePath() {
+    static const CullingPath detected = DetectPath();
+
+    int forced = s_pathOverride.load(std::memory_order_relaxed);
+    if (forced >= 0 && static_cast<CullingPath>(forced) <= detected) {
+        return static_cast<CullingPath>(forced);
+    }
+    return detected;
+}
+
+void FrustumCuller::SetPathOverride(std::optional<CullingPath> path) {
+    s_pathOverride.store(path ? static_cast<int>(*path) : -1, std::memory_order_relaxed);
+}
+
+const char* FrustumCuller::GetPathName(CullingPath path) {
+    switch (path) {
+    case CullingPath::AVX: return "AVX";
+    case CullingPath::SSE: return "SSE";
+    default: return "Scalar";
+    }
+}
+
+CullingStats FrustumCuller::Cull(const Math::Frustum& frustum, const CullingBounds& bounds,
+    std::vector<uint32_t>& visible, ThreadPool* pool) {
+    CullingStats stats;
+    const size_t count = bounds.GetCount();
+    stats.tested = static_cast<uint32_t>(count);
+    if (count == 0) return stats;
+
+    const CullingPath path = GetActivePath();
+    const PlaneArray& planes = frustum.planes;
+    const size_t padded = bounds.radius.size();
+
+    // Chunks stay lane aligned, the last one runs into the padding
+    size_t grainSize = pool ? pool->SuggestGrainSize(count, 1024) : count;
+    grainSize = (std::max<size_t>(1, grainSize) + CullingBounds::LANE_PADDING - 1)
+        / CullingBounds::LANE_PADDING * CullingBounds::LANE_PADDING;
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    if (_chunkVisible.size() < chunkCount) {
+        _chunkVisible.resize(chunkCount);
+    }
+
+    auto cullChunk = [&](size_t chunk) {
+        std::vector<uint32_t>& out = _chunkVisible[chunk];
+        out.clear();
+
+        size_t first = chunk * grainSize;
+        size_t last = std::min(first + grainSize, count);
+
+        switch (path) {
+#if defined(CULLING_X86)
+        case CullingPath::AVX:
+            CullAVX(planes, bounds, first, std::min((last + 7) / 8 * 8, padded), out);
+            break;
+        case CullingPath::SSE:
+            CullSSE(planes, bounds, first, std::min((last + 3) / 4 * 4, padded), out);
+            break;
+#endif
+        default:
+            CullScalar(planes, bounds, first, last, out);
+            break;
+        }
+        };
+
+    if (pool && chunkCount > 1) {
+        pool->ParallelFor(0, chunkCount, 1, cullChunk);
+    }
+    else {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            cullChunk(chunk);
+        }
+    }
+
+    const size_t before = visible.size();
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const std::vector<uint32_t>& out = _chunkVisible[chunk];
+        visible.insert(visible.end(), out.begin(), out.end());
+    }
+
+    stats.visible = static_cast<uint32_t>(visible.size() - before);
+    return stats;
+}
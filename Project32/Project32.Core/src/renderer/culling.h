@@ -0,0 +1,75 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef CULLING_H
+#define CULLING_H
+
+#include "../common.h"
+
+class ThreadPool;
+
+enum class CullingPath : uint8_t {
+    Scalar,
+    SSE,
+    AVX
+};
+
+// World space bounding spheres as flat arrays. Storage is padded to a whole
+// number of SIMD lanes with spheres that fail every plane test, so the
+// kernels never need a scalar tail.
+struct CullingBounds {
+    static constexpr size_t LANE_PADDING = 8;
+
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> radius;
+
+    void Resize(size_t count);
+    size_t GetCount() const { return _count; }
+
+    void Set(size_t index, const glm::vec3& center, float sphereRadius) {
+        centerX[index] = center.x;
+        centerY[index] = center.y;
+        centerZ[index] = center.z;
+        radius[index] = sphereRadius;
+    }
+
+private:
+    size_t _count = 0;
+};
+
+struct CullingStats {
+    uint32_t tested = 0;
+    uint32_t visible = 0;
+
+    uint32_t GetCulled() const { return tested - visible; }
+};
+
+// Sphere against frustum tests over CullingBounds. Picks the widest SIMD
+// path the CPU supports at runtime and splits the work across the pool.
+class FrustumCuller {
+private:
+    std::vector<std::vector<uint32_t>> _chunkVisible;
+
+public:
+    // Appends the indices of visible spheres to 'visible' in ascending order
+    CullingStats Cull(const Math::Frustum& frustum, const CullingBounds& bounds,
+        std::vector<uint32_t>& visible, ThreadPool* pool = nullptr);
+
+    static CullingPath GetActivePath();
+    static void SetPathOverride(std::optional<CullingPath> path);
+    static const char* GetPathName(CullingPath path);
+};
+
+#endif // CULLING_H
@@ -0,0 +1,94 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "draw_list.h"
+#include "../core/job_system.h"
+
+void DrawList::Build(const std::vector<RenderObjectSnapshot>& objects, const std::vector<uint32_t>* indices,
+    const DrawListParams& params, ThreadPool* pool) {
+    const size_t count = indices ? indices->size() : objects.size();
+    _items.resize(count);
+
+    const bool backToFront = params.pass == DrawPass::Transparent;
+
+    auto build = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            uint32_t objectIndex = indices ? (*indices)[i] : static_cast<uint32_t>(i);
+            const RenderObjectSnapshot& object = objects[objectIndex];
+
+            float depth = glm::dot(object.position - params.origin, params.forward);
+            uint32_t quantized = DrawKey::QuantizeDepth(depth, params.nearPlane, params.farPlane, backToFront);
+
+            uint32_t level = params.meshLods ? (*params.meshLods)[objectIndex] : 0;
+
+            // Material parameters travel per instance, so every object shares material 0
+            _items[i].key = DrawKey::Make(params.pass, params.shaderID, 0,
+                GetMeshSlot(object.shape, level), quantized);
+            _items[i].objectIndex = objectIndex;
+        }
+        };
+
+    if (pool) {
+        pool->ParallelForRange(0, count, pool->SuggestGrainSize(count, 1024), build);
+    }
+    else {
+        build(0, count);
+    }
+}
+
+void DrawList::Sort() {
+    constexpr size_t DIGITS = sizeof(uint64_t);
+    constexpr size_t BUCKETS = 256;
+
+    _sortPasses = 0;
+    const size_t count = _items.size();
+    if (count < 2) return;
+
+    // One read builds the histograms of every digit
+    std::array<std::array<uint32_t, BUCKETS>, DIGITS> histograms{};
+    for (const DrawItem& item : _items) {
+        for (size_t digit = 0; digit < DIGITS; ++digit) {
+            histograms[digit][(item.key >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    _scratch.resize(count);
+    DrawItem* source = _items.data();
+    DrawItem* destination = _scratch.data();
+
+    for (size_t digit = 0; digit < DIGITS; ++digit) {
+        std::array<uint32_t, BUCKETS>& histogram = histograms[digit];
+
+        // Every key has the same byte here, the pass would be a plain copy
+        uint32_t firstKeyBucket = (source[0].key >> (digit * 8)) & 0xFF;
+        if (histogram[firstKeyBucket] == count) continue;
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        const uint32_t shift = static_cast<uint32_t>(digit * 8);
+        for (size_t i = 0; i < count; ++i) {
+            destination[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+        }
+
+        std::swap(source, destination);
+        _sortPasses++;
+    }
+
+    if (source != _items.data()) {
+        _items.swap(_scratch);
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#include "../common.h"
+#include "frame_snapshot.h"
+#include "mesh_lod.h"
+
+class ThreadPool;
+
+enum class DrawPass : uint8_t {
+    Shadow,
+    Opaque,
+    Transparent
+};
+
+// Packed draw sort key, most significant field first:
+//   pass:4 | shader:12 | material:12 | mesh:12 | depth:24
+// Sorting ascending groups draws by state and then orders them by depth.
+namespace DrawKey {
+    constexpr uint32_t DEPTH_BITS = 24;
+    constexpr uint32_t MESH_BITS = 12;
+    constexpr uint32_t MATERIAL_BITS = 12;
+    constexpr uint32_t SHADER_BITS = 12;
+    constexpr uint32_t PASS_BITS = 4;
+
+    constexpr uint32_t MESH_SHIFT = DEPTH_BITS;
+    constexpr uint32_t MATERIAL_SHIFT = MESH_SHIFT + MESH_BITS;
+    constexpr uint32_t SHADER_SHIFT = MATERIAL_SHIFT + MATERIAL_BITS;
+    constexpr uint32_t PASS_SHIFT = SHADER_SHIFT + SHADER_BITS;
+
+    static_assert(PASS_SHIFT + PASS_BITS == 64, "Draw key fields must fill 64 bits");
+
+    constexpr uint64_t Field(uint32_t value, uint32_t bits, uint32_t shift) {
+        return static_cast<uint64_t>(value & ((1u << bits) - 1)) << shift;
+    }
+
+    constexpr uint64_t Make(DrawPass pass, uint32_t shader, uint32_t material, uint32_t mesh, uint32_t depth) {
+        return Field(static_cast<uint32_t>(pass), PASS_BITS, PASS_SHIFT)
+            | Field(shader, SHADER_BITS, SHADER_SHIFT)
+            | Field(material, MATERIAL_BITS, MATERIAL_SHIFT)
+            | Field(mesh, MESH_BITS, MESH_SHIFT)
+            | Field(depth, DEPTH_BITS, 0);
+    }
+
+    // Everything but depth, equal state bits can share one draw
+    constexpr uint64_t GetState(uint64_t key) { return key >> DEPTH_BITS; }
+    constexpr uint32_t GetMesh(uint64_t key) {
+        return static_cast<uint32_t>(key >> MESH_SHIFT) & ((1u << MESH_BITS) - 1);
+    }
+
+    // Linear depth between the planes mapped to 24 bits, reversed for
+    // back to front passes
+    inline uint32_t QuantizeDepth(float depth, float nearPlane, float farPlane, bool backToFront = false) {
+        constexpr uint32_t MAX_DEPTH = (1u << DEPTH_BITS) - 1;
+        float t = glm::clamp((depth - nearPlane) / (farPlane - nearPlane), 0.0f, 1.0f);
+        uint32_t quantized = static_cast<uint32_t>(t * static_cast<float>(MAX_DEPTH));
+        return backToFront ? MAX_DEPTH - quantized : quantized;
+    }
+}
+
+struct DrawItem {
+    uint64_t key = 0;
+    uint32_t objectIndex = 0;
+};
+
+// Where keys for one pass come from. Depth is measured along 'forward' from
+// 'origin', so it works for perspective cameras and orthographic lights alike.
+struct DrawListParams {
+    DrawPass pass = DrawPass::Opaque;
+    uint32_t shaderID = 0;
+    glm::vec3 origin{ 0.0f };
+    glm::vec3 forward{ 0.0f, 0.0f, -1.0f };
+    float nearPlane = 0.1f;
+    float farPlane = 1000.0f;
+
+    // LOD level per snapshot object, every object draws level 0 when null
+    const std::vector<uint8_t>* meshLods = nullptr;
+};
+
+// Keyed draws of one pass, radix sorted before they are turned into batches
+class DrawList {
+private:
+    std::vector<DrawItem> _items;
+    std::vector<DrawItem> _scratch;
+    uint32_t _sortPasses = 0;
+
+public:
+    void Clear() { _items.clear(); }
+
+    // Keys every object in 'indices' (all objects when null). The mesh field
+    // holds the mesh slot of the object's shape and LOD level.
+    void Build(const std::vector<RenderObjectSnapshot>& objects, const std::vector<uint32_t>* indices,
+        const DrawListParams& params, ThreadPool* pool = nullptr);
+
+    void Add(uint64_t key, uint32_t objectIndex) { _items.push_back({ key, objectIndex }); }
+
+    // Stable LSD radix sort on 8 bit digits, digits that are equal across the
+    // whole list are skipped so constant pass/shader bits cost nothing
+    void Sort();
+
+    const std::vector<DrawItem>& GetItems() const { return _items; }
+    size_t GetCount() const { return _items.size(); }
+    uint32_t GetLastSortPasses() const { return _sortPasses; }
+};
+
+#endif // DRAW_LIST_H
@@ -0,0 +1,104 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "frame_snapshot.h"
+#include "../core/job_system.h"
+
+namespace {
+    glm::quat EulerDegreesToQuat(const glm::vec3& rotation) {
+        return glm::angleAxis(glm::radians(rotation.y), glm::vec3(0, 1, 0))
+            * glm::angleAxis(glm::radians(rotation.x), glm::vec3(1, 0, 0))
+            * glm::angleAxis(glm::radians(rotation.z), glm::vec3(0, 0, 1));
+    }
+}
+
+void FixedStepHistory::Record(const RenderProxyStore& proxies) {
+    _previous.swap(_current);
+    _current.clear();
+
+    for (const RenderProxy& proxy : proxies.GetProxies()) {
+        if (!proxy.interpolate) continue;
+
+        FixedTransformState& state = _current[proxy.objectID];
+        state.position = proxy.position;
+        state.rotation = proxy.rotation;
+    }
+}
+
+bool FixedStepHistory::Get(int objectID, FixedTransformState& previous, FixedTransformState& current) const {
+    auto currentIt = _current.find(objectID);
+    if (currentIt == _current.end()) return false;
+
+    auto previousIt = _previous.find(objectID);
+    current = currentIt->second;
+    previous = previousIt != _previous.end() ? previousIt->second : currentIt->second;
+    return true;
+}
+
+void FrameSnapshot::Capture(const RenderProxyStore& proxies, const FixedStepHistory* history) {
+    const CameraProxy& cameraProxy = proxies.GetCamera();
+    if (cameraProxy.active) {
+        camera.position = cameraProxy.position;
+        camera.rotation = cameraProxy.rotation;
+    }
+
+    const std::vector<RenderProxy>& source = proxies.GetProxies();
+    objects.reserve(source.size());
+
+    for (const RenderProxy& proxy : source) {
+        if (!proxy.visible) continue;
+
+        RenderObjectSnapshot& object = objects.emplace_back();
+        object.objectID = proxy.objectID;
+        object.shape = proxy.shape;
+        object.isStatic = proxy.isStatic;
+        object.position = proxy.position;
+        object.rotation = proxy.rotation;
+        object.scale = proxy.scale;
+        object.color = proxy.color;
+        object.metallic = proxy.metallic;
+        object.roughness = proxy.roughness;
+
+        FixedTransformState previous, current;
+        if (proxy.interpolate && history && history->Get(proxy.objectID, previous, current)) {
+            // Draw between the last two fixed states instead of the raw one
+            object.position = glm::mix(previous.position, current.position, interpolationAlpha);
+            object.orientation = glm::slerp(EulerDegreesToQuat(previous.rotation),
+                EulerDegreesToQuat(current.rotation), interpolationAlpha);
+        }
+        else {
+            object.orientation = EulerDegreesToQuat(object.rotation);
+        }
+    }
+}
+
+void FrameSnapshot::BuildTransforms(ThreadPool* pool) {
+    auto build = [this](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            RenderObjectSnapshot& object = objects[i];
+
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), object.position);
+            model *= glm::mat4_cast(object.orientation);
+            object.model = glm::scale(model, object.scale);
+
+            // Unit cube and sphere meshes both fit in a 0.5 radius sphere
+            object.boundingRadius = 0.5f * glm::length(object.scale);
+        }
+        };
+
+    if (pool) {
+        pool->ParallelForRange(0, objects.size(), pool->SuggestGrainSize(objects.size(), 256), build);
+    }
+    else {
+        build(0, objects.size());
+    }
+}
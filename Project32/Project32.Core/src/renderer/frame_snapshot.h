@@ -0,0 +1,137 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+#include "../common.h"
+#include "../scene/render_proxy.h"
+
+class ThreadPool;
+
+struct RenderObjectSnapshot {
+    int objectID = -1;
+    RenderShape shape = RenderShape::Cube;
+    bool isStatic = false;
+
+    glm::vec3 position{ 0.0f };
+    glm::vec3 rotation{ 0.0f };
+    glm::vec3 scale{ 1.0f };
+    glm::quat orientation{ 1.0f, 0.0f, 0.0f, 0.0f };
+
+    // Filled in by FrameSnapshot::BuildTransforms()
+    glm::mat4 model{ 1.0f };
+    float boundingRadius = 0.5f;
+
+    glm::vec3 color{ 1.0f };
+    float metallic = 0.0f;
+    float roughness = 0.5f;
+};
+
+struct FixedTransformState {
+    glm::vec3 position{ 0.0f };
+    glm::vec3 rotation{ 0.0f };
+};
+
+// Transforms of proxies flagged 'interpolate' after the last two fixed steps,
+// recorded on the update thread right after each FixedUpdate.
+class FixedStepHistory {
+private:
+    std::unordered_map<int, FixedTransformState> _previous;
+    std::unordered_map<int, FixedTransformState> _current;
+
+public:
+    void Record(const RenderProxyStore& proxies);
+    void Clear() { _previous.clear(); _current.clear(); }
+
+    bool Get(int objectID, FixedTransformState& previous, FixedTransformState& current) const;
+};
+
+struct CameraSnapshot {
+    glm::vec3 position{ 0.0f, 1.7f, 5.0f };
+    glm::vec3 rotation{ 0.0f };
+};
+
+// Everything the renderer needs for one frame, copied out of the simulation
+// on the update thread so rendering never touches live simulation state.
+struct FrameSnapshot {
+    uint64_t frameIndex = 0;
+    float deltaTime = 0.0f;
+    float fixedDeltaTime = 0.0f;
+    float interpolationAlpha = 0.0f;
+
+    CameraSnapshot camera;
+    std::vector<RenderObjectSnapshot> objects;
+
+    // Keeps vector capacity so steady-state frames do not allocate
+    void Clear() {
+        frameIndex = 0;
+        deltaTime = 0.0f;
+        fixedDeltaTime = 0.0f;
+        interpolationAlpha = 0.0f;
+        camera = CameraSnapshot{};
+        objects.clear();
+    }
+
+    // Objects with history are blended by interpolationAlpha between their
+    // last two fixed-step states, so set the alpha before capturing
+    void Capture(const RenderProxyStore& proxies, const FixedStepHistory* history = nullptr);
+
+    // Model matrices and bounds from the captured transforms, touches only
+    // the snapshot so it may run on any thread
+    void BuildTransforms(ThreadPool* pool = nullptr);
+};
+
+// Lock-free triple buffer, single producer (update thread) and single
+// consumer (render thread). The producer always has a free slot to write, the
+// consumer always gets the most recent published frame.
+class FrameSnapshotBuffer {
+private:
+    static constexpr uint32_t INDEX_MASK = 0x3;
+    static constexpr uint32_t FRESH_BIT = 0x4;
+
+    std::array<FrameSnapshot, 3> _slots;
+    std::atomic<uint32_t> _shared{ 1 };
+    uint32_t _writeIndex = 0;
+    uint32_t _readIndex = 2;
+
+public:
+    FrameSnapshot& BeginWrite() {
+        FrameSnapshot& slot = _slots[_writeIndex];
+        slot.Clear();
+        return slot;
+    }
+
+    void Publish() {
+        uint32_t previous = _shared.exchange(_writeIndex | FRESH_BIT, std::memory_order_acq_rel);
+        _writeIndex = previous & INDEX_MASK;
+    }
+
+    bool HasFreshFrame() const {
+        return (_shared.load(std::memory_order_acquire) & FRESH_BIT) != 0;
+    }
+
+    // Swaps in the newest published frame if there is one, otherwise keeps
+    // returning the previous frame
+    const FrameSnapshot& AcquireLatest() {
+        if (HasFreshFrame()) {
+            uint32_t previous = _shared.exchange(_readIndex, std::memory_order_acq_rel);
+            _readIndex = previous & INDEX_MASK;
+        }
+        return _slots[_readIndex];
+    }
+
+    const FrameSnapshot& GetCurrentRead() const { return _slots[_readIndex]; }
+};
+
+#endif // FRAME_SNAPSHOT_H
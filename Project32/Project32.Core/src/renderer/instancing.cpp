@@ -0,0 +1,133 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "instancing.h"
+#include "command_buffer.h"
+#include "../core/job_system.h"
+
+void InstanceBatcher::Clear() {
+    _instances.clear();
+    _batches.clear();
+    _indirectCommands.clear();
+}
+
+InstanceBatchRange InstanceBatcher::AddPass(const std::vector<RenderObjectSnapshot>& objects,
+    const DrawList& drawList,
+    const std::array<Mesh*, MESH_SLOT_COUNT>& meshes,
+    ThreadPool* pool) {
+    InstanceBatchRange range;
+    range.firstBatch = static_cast<uint32_t>(_batches.size());
+
+    const std::vector<DrawItem>& items = drawList.GetItems();
+    const size_t count = items.size();
+    if (count == 0) return range;
+
+    _batchFirstItem.clear();
+
+    uint32_t cursor = static_cast<uint32_t>(_instances.size());
+    size_t runStart = 0;
+    for (size_t i = 1; i <= count; ++i) {
+        if (i < count && DrawKey::GetState(items[i].key) == DrawKey::GetState(items[runStart].key)) {
+            continue;
+        }
+
+        uint32_t meshIndex = DrawKey::GetMesh(items[runStart].key);
+        Mesh* mesh = meshIndex < meshes.size() ? meshes[meshIndex] : nullptr;
+        if (mesh) {
+            uint32_t runLength = static_cast<uint32_t>(i - runStart);
+            _batches.push_back({ mesh, cursor, runLength });
+            _batchFirstItem.push_back(static_cast<uint32_t>(runStart));
+            cursor += runLength;
+        }
+        runStart = i;
+    }
+
+    _instances.resize(cursor);
+    range.batchCount = static_cast<uint32_t>(_batches.size()) - range.firstBatch;
+
+    for (uint32_t b = 0; b < range.batchCount; ++b) {
+        const InstanceBatch& batch = _batches[range.firstBatch + b];
+        const DrawItem* runItems = items.data() + _batchFirstItem[b];
+        InstanceData* runInstances = _instances.data() + batch.firstInstance;
+
+        auto fill = [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                const RenderObjectSnapshot& object = objects[runItems[i].objectIndex];
+
+                InstanceData& instance = runInstances[i];
+                instance.model = object.model;
+                instance.color = glm::vec4(object.color, 1.0f);
+                instance.material = glm::vec4(object.metallic, object.roughness, 1.0f, 0.0f);
+            }
+            };
+
+        if (pool) {
+            pool->ParallelForRange(0, batch.instanceCount, pool->SuggestGrainSize(batch.instanceCount, 256), fill);
+        }
+        else {
+            fill(0, batch.instanceCount);
+        }
+    }
+
+    return range;
+}
+
+void InstanceBatcher::RecordDraws(InstanceBatchRange range, CommandBuffer& commands) const {
+    for (uint32_t i = 0; i < range.batchCount; ++i) {
+        const InstanceBatch& batch = _batches[range.firstBatch + i];
+        commands.DrawInstanced(*batch.mesh, batch.instanceCount, batch.firstInstance);
+    }
+}
+
+void InstanceBatcher::ReserveIndirectCommands() {
+    _indirectCommands.assign(_batches.size(), IndirectDrawCommand{});
+}
+
+void InstanceBatcher::RecordIndirectDraws(InstanceBatchRange range, const GeometryArena& arena, CommandBuffer& commands) {
+    // Slots follow batch order, so a run of arena batches is a contiguous
+    // run of commands. Slots of batches drawn directly stay unused.
+    uint32_t runStart = range.firstBatch;
+    uint32_t runEnd = range.firstBatch;
+    uint64_t runTriangles = 0;
+
+    auto flushRun = [&]() {
+        if (runEnd > runStart) {
+            commands.MultiDrawIndexedIndirect(arena.GetVAO(), runStart, runEnd - runStart, runTriangles);
+        }
+        runTriangles = 0;
+    };
+
+    for (uint32_t i = 0; i < range.batchCount; ++i) {
+        uint32_t index = range.firstBatch + i;
+        const InstanceBatch& batch = _batches[index];
+        const GeometryRange* geometry = arena.Find(*batch.mesh);
+
+        if (!geometry) {
+            flushRun();
+            runStart = runEnd = index + 1;
+            commands.DrawInstanced(*batch.mesh, batch.instanceCount, batch.firstInstance);
+            continue;
+        }
+
+        IndirectDrawCommand& command = _indirectCommands[index];
+        command.indexCount = geometry->indexCount;
+        command.instanceCount = batch.instanceCount;
+        command.firstIndex = geometry->firstIndex;
+        command.baseVertex = geometry->baseVertex;
+        command.baseInstance = batch.firstInstance;
+
+        runEnd = index + 1;
+        runTriangles += static_cast<uint64_t>(geometry->indexCount / 3) * batch.instanceCount;
+    }
+
+    flushRun();
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include "../common.h"
+#include "vertex.h"
+#include "frame_snapshot.h"
+#include "draw_list.h"
+
+class Mesh;
+class ThreadPool;
+class CommandBuffer;
+class GeometryArena;
+
+// One instanced draw, instances [firstInstance, firstInstance + instanceCount)
+// of the shared instance buffer
+struct InstanceBatch {
+    Mesh* mesh = nullptr;
+    uint32_t firstInstance = 0;
+    uint32_t instanceCount = 0;
+};
+
+struct InstanceBatchRange {
+    uint32_t firstBatch = 0;
+    uint32_t batchCount = 0;
+};
+
+// Turns sorted draw lists into instanced draws. Every run of equal state
+// bits becomes one batch, instances keep the draw list (depth) order. All
+// passes append to the same instance array, which is uploaded once per
+// frame. Needs no graphics context.
+class InstanceBatcher {
+private:
+    std::vector<InstanceData> _instances;
+    std::vector<InstanceBatch> _batches;
+    std::vector<uint32_t> _batchFirstItem;
+    std::vector<IndirectDrawCommand> _indirectCommands;
+
+public:
+    void Clear();
+
+    // The mesh field of each key indexes 'meshes', runs without a mesh are skipped
+    InstanceBatchRange AddPass(const std::vector<RenderObjectSnapshot>& objects,
+        const DrawList& drawList,
+        const std::array<Mesh*, MESH_SLOT_COUNT>& meshes,
+        ThreadPool* pool = nullptr);
+
+    void RecordDraws(InstanceBatchRange range, CommandBuffer& commands) const;
+
+    // Gives every batch added so far one indirect command slot, call after
+    // the last AddPass and before RecordIndirectDraws
+    void ReserveIndirectCommands();
+
+    // Every run of batches whose meshes live in the arena becomes one
+    // multi-draw, the rest fall back to RecordDraws. A batch writes only its
+    // own indirect slot, so passes may record at the same time. Base
+    // instances are relative to the instance array.
+    void RecordIndirectDraws(InstanceBatchRange range, const GeometryArena& arena, CommandBuffer& commands);
+
+    const std::vector<InstanceData>& GetInstances() const { return _instances; }
+    const std::vector<InstanceBatch>& GetBatches() const { return _batches; }
+    const std::vector<IndirectDrawCommand>& GetIndirectCommands() const { return _indirectCommands; }
+    size_t GetInstanceCount() const { return _instances.size(); }
+    size_t GetSizeBytes() const { return _instances.size() * sizeof(InstanceData); }
+};
+
+#endif // INSTANCING_H
@@ -0,0 +1,145 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "light_clusters.h"
+#include "../core/job_system.h"
+
+LightClusterGrid::LightClusterGrid(const glm::uvec3& size)
+    : _size(glm::max(size, glm::uvec3(1u)))
+{
+}
+
+float LightClusterGrid::GetSliceDepth(uint32_t slice, uint32_t sliceCount, float nearPlane, float farPlane) {
+    return nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(slice) / static_cast<float>(sliceCount));
+}
+
+void LightClusterGrid::Build(const std::vector<GpuLight>& lights, const glm::mat4& view,
+    float fovY, float aspect, float nearPlane, float farPlane,
+    ThreadPool* pool) {
+    _nearPlane = std::max(nearPlane, 0.001f);
+    _farPlane = std::max(farPlane, _nearPlane + 0.001f);
+
+    _ranges.assign(GetClusterCount(), glm::uvec2(0u));
+    _indices.clear();
+    _stats = {};
+    _stats.lightCount = static_cast<uint32_t>(lights.size());
+
+    // Spot lights are bounded by the sphere of their range as well
+    _viewSpheres.resize(lights.size());
+    for (size_t i = 0; i < lights.size(); ++i) {
+        glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(lights[i].positionRange), 1.0f));
+        _viewSpheres[i] = glm::vec4(center, lights[i].positionRange.w);
+    }
+
+    _slices.resize(_size.z);
+
+    const float tanHalfY = std::tan(fovY * 0.5f);
+    const float tanHalfX = tanHalfY * aspect;
+
+    auto buildSlice = [&](size_t z) {
+        Slice& slice = _slices[z];
+        slice.candidates.clear();
+        slice.indices.clear();
+        slice.maxPerCluster = 0;
+        slice.overflows = 0;
+
+        const float sliceNear = GetSliceDepth(static_cast<uint32_t>(z), _size.z, _nearPlane, _farPlane);
+        const float sliceFar = GetSliceDepth(static_cast<uint32_t>(z) + 1, _size.z, _nearPlane, _farPlane);
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(_viewSpheres.size()); ++i) {
+            const glm::vec4& sphere = _viewSpheres[i];
+            float depth = -sphere.z;
+            if (depth + sphere.w >= sliceNear && depth - sphere.w <= sliceFar) {
+                slice.candidates.push_back(i);
+            }
+        }
+
+        for (uint32_t y = 0; y < _size.y; ++y) {
+            float y0 = -1.0f + 2.0f * static_cast<float>(y) / static_cast<float>(_size.y);
+            float y1 = -1.0f + 2.0f * static_cast<float>(y + 1) / static_cast<float>(_size.y);
+
+            for (uint32_t x = 0; x < _size.x; ++x) {
+                float x0 = -1.0f + 2.0f * static_cast<float>(x) / static_cast<float>(_size.x);
+                float x1 = -1.0f + 2.0f * static_cast<float>(x + 1) / static_cast<float>(_size.x);
+
+                // View space box around the tile between both slice depths
+                glm::vec3 boxMin(
+                    std::min(x0 * tanHalfX * sliceNear, x0 * tanHalfX * sliceFar),
+                    std::min(y0 * tanHalfY * sliceNear, y0 * tanHalfY * sliceFar),
+                    -sliceFar);
+                glm::vec3 boxMax(
+                    std::max(x1 * tanHalfX * sliceNear, x1 * tanHalfX * sliceFar),
+                    std::max(y1 * tanHalfY * sliceNear, y1 * tanHalfY * sliceFar),
+                    -sliceNear);
+
+                glm::uvec2& range = _ranges[GetClusterIndex(x, y, static_cast<uint32_t>(z))];
+                range.x = static_cast<uint32_t>(slice.indices.size());
+
+                for (uint32_t light : slice.candidates) {
+                    const glm::vec4& sphere = _viewSpheres[light];
+                    glm::vec3 center(sphere);
+                    glm::vec3 closest = glm::clamp(center, boxMin, boxMax);
+                    glm::vec3 delta = center - closest;
+                    if (glm::dot(delta, delta) > sphere.w * sphere.w) continue;
+
+                    if (range.y == MAX_LIGHTS_PER_CLUSTER) {
+                        ++slice.overflows;
+                        break;
+                    }
+                    slice.indices.push_back(light);
+                    ++range.y;
+                }
+
+                slice.maxPerCluster = std::max(slice.maxPerCluster, range.y);
+            }
+        }
+        };
+
+    if (pool && _size.z > 1) {
+        pool->ParallelFor(0, _size.z, 1, buildSlice);
+    }
+    else {
+        for (size_t z = 0; z < _size.z; ++z) {
+            buildSlice(z);
+        }
+    }
+
+    // Slice offsets were local, stitch them into one index list
+    const uint32_t clustersPerSlice = _size.x * _size.y;
+    for (uint32_t z = 0; z < _size.z; ++z) {
+        const Slice& slice = _slices[z];
+        uint32_t base = static_cast<uint32_t>(_indices.size());
+
+        for (uint32_t c = 0; c < clustersPerSlice; ++c) {
+            _ranges[z * clustersPerSlice + c].x += base;
+        }
+        _indices.insert(_indices.end(), slice.indices.begin(), slice.indices.end());
+
+        _stats.maxPerCluster = std::max(_stats.maxPerCluster, slice.maxPerCluster);
+        _stats.overflows += slice.overflows;
+    }
+    _stats.indexCount = static_cast<uint32_t>(_indices.size());
+}
+
+void LightClusterGrid::FillUniformBlock(ClusterBlock& block, int width, int height) const {
+    // slice = log(depth) * scale - bias inverts GetSliceDepth
+    float logRatio = std::log(_farPlane / _nearPlane);
+    float scale = static_cast<float>(_size.z) / logRatio;
+    float bias = static_cast<float>(_size.z) * std::log(_nearPlane) / logRatio;
+
+    block.grid = glm::uvec4(_size, _stats.lightCount);
+    block.depth = glm::vec4(_nearPlane, _farPlane, scale, bias);
+    block.tile = glm::vec4(
+        static_cast<float>(std::max(width, 1)) / static_cast<float>(_size.x),
+        static_cast<float>(std::max(height, 1)) / static_cast<float>(_size.y),
+        0.0f, 0.0f);
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef LIGHT_CLUSTERS_H
+#define LIGHT_CLUSTERS_H
+
+#include "../common.h"
+#include "uniform_blocks.h"
+
+class ThreadPool;
+
+constexpr uint32_t MAX_LIGHTS_PER_CLUSTER = 128;
+
+struct LightClusterStats {
+    uint32_t lightCount = 0;
+    uint32_t indexCount = 0;        // light references over all clusters
+    uint32_t maxPerCluster = 0;
+    uint32_t overflows = 0;         // clusters that dropped lights past the cap
+};
+
+// Froxel grid over the camera frustum, screen tiles times exponential depth
+// slices. Each cluster lists the point and spot lights whose range reaches
+// it, so shading only loops over lights that can affect the fragment.
+// Slices are built in parallel, pure CPU work with no graphics context.
+class LightClusterGrid {
+private:
+    struct Slice {
+        std::vector<uint32_t> candidates;
+        std::vector<uint32_t> indices;
+        uint32_t maxPerCluster = 0;
+        uint32_t overflows = 0;
+    };
+
+    glm::uvec3 _size;
+    float _nearPlane = 0.1f;
+    float _farPlane = 1000.0f;
+
+    std::vector<glm::uvec2> _ranges;        // offset into _indices and count, per cluster
+    std::vector<uint32_t> _indices;
+    std::vector<glm::vec4> _viewSpheres;    // view space center and range, per light
+    std::vector<Slice> _slices;
+    LightClusterStats _stats;
+
+public:
+    explicit LightClusterGrid(const glm::uvec3& size = glm::uvec3(16, 9, 24));
+
+    void Build(const std::vector<GpuLight>& lights, const glm::mat4& view,
+        float fovY, float aspect, float nearPlane, float farPlane,
+        ThreadPool* pool = nullptr);
+
+    void FillUniformBlock(ClusterBlock& block, int width, int height) const;
+
+    const glm::uvec3& GetSize() const { return _size; }
+    uint32_t GetClusterCount() const { return _size.x * _size.y * _size.z; }
+    uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const { return x + _size.x * (y + _size.y * z); }
+
+    const std::vector<glm::uvec2>& GetRanges() const { return _ranges; }
+    const std::vector<uint32_t>& GetIndices() const { return _indices; }
+    const LightClusterStats& GetStats() const { return _stats; }
+
+    // View space depth where a slice starts, slice == count gives the far plane
+    static float GetSliceDepth(uint32_t slice, uint32_t sliceCount, float nearPlane, float farPlane);
+};
+
+#endif // LIGHT_CLUSTERS_H
@@ -4,6 +4,7 @@
 #define LIGHTING_H
 
 #include "../common.h"
+#include "uniform_blocks.h"
 
 enum class LightType {
     DIRECTIONAL,
@@ -34,7 +35,9 @@ struct Light {
 
 class LightingSystem {
 public:
-    static constexpr int MAX_LIGHTS = 8;
+    // Point and spot lights go through the light clusters, only the first
+    // MAX_GPU_LIGHTS lights fit the uniform block when clustering is off
+    static constexpr int MAX_LIGHTS = 4096;
 
     LightingSystem() = default;
 
@@ -76,44 +79,49 @@ public:
         m_lights.clear();
     }
 
-    void BindToShader(IGraphicsBackend* backend, int shaderID) {
-        if (!backend) return;
-
-        std::vector<glm::vec3> positions;
-        std::vector<glm::vec3> colors;
-        std::vector<glm::vec3> directions;
-        std::vector<float> ranges;
-        std::vector<int> types;
-
+    // Packs the enabled lights into the std140 light block, the caller
+    // uploads it only when it changed. With clustered lighting the block
+    // only carries directional lights.
+    void FillUniformBlock(LightBlock& block, bool clustered = false) const {
+        int slot = 0;
         for (const auto& light : m_lights) {
             if (!light.enabled) continue;
+            if (clustered && light.type != LightType::DIRECTIONAL) continue;
+            if (slot == MAX_GPU_LIGHTS) break;
 
-            positions.push_back(light.position);
-            colors.push_back(light.color * light.intensity);
-            directions.push_back(light.direction);
-            ranges.push_back(light.range);
-            types.push_back(static_cast<int>(light.type));
+            block.lights[slot++] = PackLight(light);
         }
 
-        int activeCount = static_cast<int>(positions.size());
-        backend->SetShaderInt(shaderID, "numLights", activeCount);
-
-        for (int i = 0; i < activeCount; ++i) {
-            std::string base = "lightPositions[" + std::to_string(i) + "]";
-            backend->SetShaderVec3(shaderID, base, positions[i]);
-
-            base = "lightColors[" + std::to_string(i) + "]";
-            backend->SetShaderVec3(shaderID, base, colors[i]);
+        for (int i = slot; i < MAX_GPU_LIGHTS; ++i) {
+            block.lights[i] = GpuLight{};
+        }
+        block.count = glm::ivec4(slot, 0, 0, 0);
+    }
 
-            base = "lightDirections[" + std::to_string(i) + "]";
-            backend->SetShaderVec3(shaderID, base, directions[i]);
+    // Enabled point and spot lights in the layout of the cluster light buffer
+    void FillClusteredLights(std::vector<GpuLight>& out) const {
+        out.clear();
+        for (const auto& light : m_lights) {
+            if (!light.enabled || light.type == LightType::DIRECTIONAL) continue;
+            out.push_back(PackLight(light));
+        }
+    }
 
-            base = "lightRanges[" + std::to_string(i) + "]";
-            backend->SetShaderFloat(shaderID, base, ranges[i]);
+    static GpuLight PackLight(const Light& light) {
+        GpuLight gpu;
+        gpu.positionRange = glm::vec4(light.position, light.range);
+        gpu.colorType = glm::vec4(light.color * light.intensity, static_cast<float>(light.type));
+        gpu.directionShadow = glm::vec4(glm::normalize(light.direction), light.castsShadows ? 1.0f : 0.0f);
+        gpu.spotCutoff = glm::vec4(light.innerCutoff, light.outerCutoff, 0.0f, 0.0f);
+        return gpu;
+    }
 
-            base = "lightTypes[" + std::to_string(i) + "]";
-            backend->SetShaderInt(shaderID, base, types[i]);
+    // First enabled light flagged as a shadow caster, or nullptr
+    const Light* GetShadowCaster() const {
+        for (const auto& light : m_lights) {
+            if (light.enabled && light.castsShadows) return &light;
         }
+        return nullptr;
     }
 
     void SetupDefaultLighting() {
@@ -0,0 +1,356 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "mesh_lod.h"
+#include "../core/job_system.h"
+
+bool MeshLodChain::AddLevel(Mesh* mesh, float error) {
+    if (!mesh || _count >= MAX_MESH_LODS) return false;
+
+    // Errors must grow along the chain for Select to walk it
+    if (_count > 0) error = std::max(error, _levels[_count - 1].error);
+
+    _levels[_count++] = { mesh, error };
+    return true;
+}
+
+uint32_t MeshLodChain::Select(float pixelsPerUnit, float thresholdPixels, float hysteresis, uint32_t current) const {
+    if (_count <= 1) return 0;
+
+    float refineAbove = thresholdPixels * (1.0f + hysteresis);
+    float coarsenBelow = thresholdPixels * (1.0f - hysteresis);
+
+    uint32_t level = std::min(current, _count - 1);
+    while (level > 0 && _levels[level].error * pixelsPerUnit > refineAbove) --level;
+    while (level + 1 < _count && _levels[level + 1].error * pixelsPerUnit <= coarsenBelow) ++level;
+    return level;
+}
+
+void LodSelector::Select(const std::vector<RenderObjectSnapshot>& objects, const CullingBounds& bounds,
+    const std::array<MeshLodChain, RENDER_SHAPE_COUNT>& chains, const LodSelectParams& params,
+    ThreadPool* pool) {
+    const size_t count = objects.size();
+
+    _previousLevels.swap(_levels);
+    _previousIDs.swap(_objectIDs);
+    _levels.resize(count);
+    _objectIDs.resize(count);
+
+    auto select = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            const RenderObjectSnapshot& object = objects[i];
+            const MeshLodChain& chain = chains[static_cast<size_t>(object.shape)];
+            _objectIDs[i] = object.objectID;
+
+            if (chain.GetCount() <= 1) {
+                _levels[i] = 0;
+                continue;
+            }
+
+            // Nearest point of the bounding sphere, errors scale with the largest axis
+            glm::vec3 center(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i]);
+            float distance = std::max(glm::length(center - params.cameraPos) - bounds.radius[i], params.nearPlane);
+            float scale = std::max({ glm::length(glm::vec3(object.model[0])),
+                glm::length(glm::vec3(object.model[1])),
+                glm::length(glm::vec3(object.model[2])) });
+            float pixelsPerUnit = params.projectionScale * scale / distance;
+
+            // Objects seen for the first time get no hysteresis
+            bool known = i < _previousIDs.size() && _previousIDs[i] == object.objectID;
+            uint32_t current = known ? _previousLevels[i] : 0;
+            float hysteresis = known ? params.hysteresis : 0.0f;
+
+            _levels[i] = static_cast<uint8_t>(chain.Select(pixelsPerUnit, params.thresholdPixels, hysteresis, current));
+        }
+        };
+
+    if (pool) {
+        pool->ParallelForRange(0, count, pool->SuggestGrainSize(count, 1024), select);
+    }
+    else {
+        select(0, count);
+    }
+
+    _stats = {};
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t level = _levels[i];
+        _stats.objectsPerLevel[level]++;
+        if (i < _previousIDs.size() && _previousIDs[i] == _objectIDs[i] && _previousLevels[i] != level) {
+            _stats.switches++;
+        }
+
+        const MeshLodChain& chain = chains[static_cast<size_t>(objects[i].shape)];
+        if (chain.GetCount() == 0) continue;
+        _stats.selectedTriangles += chain.GetLevel(level).mesh->GetIndexCount() / 3;
+        _stats.fullTriangles += chain.GetLevel(0).mesh->GetIndexCount() / 3;
+    }
+}
+
+void LodSelector::Reset() {
+    _levels.clear();
+    _objectIDs.clear();
+    _previousLevels.clear();
+    _previousIDs.clear();
+    _stats = {};
+}
+
+namespace {
+    // Area weighted sum of squared distances to a set of planes, symmetric
+    // 4x4 kept as its upper triangle
+    struct Quadric {
+        double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+        double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+        double a22 = 0.0, a23 = 0.0;
+        double a33 = 0.0;
+        double weight = 0.0;
+
+        static Quadric FromPlane(const glm::dvec3& n, double d, double w) {
+            Quadric q;
+            q.a00 = w * n.x * n.x; q.a01 = w * n.x * n.y; q.a02 = w * n.x * n.z; q.a03 = w * n.x * d;
+            q.a11 = w * n.y * n.y; q.a12 = w * n.y * n.z; q.a13 = w * n.y * d;
+            q.a22 = w * n.z * n.z; q.a23 = w * n.z * d;
+            q.a33 = w * d * d;
+            q.weight = w;
+            return q;
+        }
+
+        Quadric& operator+=(const Quadric& o) {
+            a00 += o.a00; a01 += o.a01; a02 += o.a02; a03 += o.a03;
+            a11 += o.a11; a12 += o.a12; a13 += o.a13;
+            a22 += o.a22; a23 += o.a23;
+            a33 += o.a33;
+            weight += o.weight;
+            return *this;
+        }
+
+        // Mean squared distance over the planes
+        double Evaluate(const glm::vec3& p) const {
+            if (weight <= 0.0) return 0.0;
+            double x = p.x, y = p.y, z = p.z;
+            return (a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x
+                + a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y
+                + a22 * z * z + 2.0 * a23 * z
+                + a33) / weight;
+        }
+    };
+
+    struct Collapse {
+        float cost;
+        uint32_t from;
+        uint32_t to;
+    };
+
+    // Vertices that must stay: ends of edges with one or more than two
+    // triangles, and vertices sharing a position with another vertex
+    void FindLockedVertices(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+        std::vector<uint8_t>& locked) {
+        const size_t vertexCount = vertices.size();
+        locked.assign(vertexCount, 0);
+
+        std::vector<uint64_t> edges;
+        edges.reserve(indices.size());
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            for (int e = 0; e < 3; ++e) {
+                uint32_t a = indices[t + e];
+                uint32_t b = indices[t + (e + 1) % 3];
+                edges.push_back((static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        for (size_t i = 0; i < edges.size();) {
+            size_t run = i + 1;
+            while (run < edges.size() && edges[run] == edges[i]) ++run;
+            if (run - i != 2) {
+                locked[static_cast<uint32_t>(edges[i] >> 32)] = 1;
+                locked[static_cast<uint32_t>(edges[i])] = 1;
+            }
+            i = run;
+        }
+
+        std::vector<uint32_t> order(vertexCount);
+        std::iota(order.begin(), order.end(), 0u);
+        auto less = [&](uint32_t a, uint32_t b) {
+            const glm::vec3& p = vertices[a].position;
+            const glm::vec3& q = vertices[b].position;
+            if (p.x != q.x) return p.x < q.x;
+            if (p.y != q.y) return p.y < q.y;
+            return p.z < q.z;
+        };
+        std::sort(order.begin(), order.end(), less);
+
+        for (size_t i = 1; i < vertexCount; ++i) {
+            if (vertices[order[i]].position == vertices[order[i - 1]].position) {
+                locked[order[i]] = 1;
+                locked[order[i - 1]] = 1;
+            }
+        }
+    }
+
+    // Whether moving 'from' onto 'to' turns any remaining triangle around
+    // 'from' over or close to edge on
+    bool FlipsTriangles(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+        const uint32_t* triangles, uint32_t triangleCount, uint32_t from, uint32_t to) {
+        for (uint32_t i = 0; i < triangleCount; ++i) {
+            const unsigned int* tri = &indices[static_cast<size_t>(triangles[i]) * 3];
+            if (tri[0] == to || tri[1] == to || tri[2] == to) continue;
+
+            glm::vec3 p[3];
+            glm::vec3 q[3];
+            for (int k = 0; k < 3; ++k) {
+                p[k] = vertices[tri[k]].position;
+                q[k] = tri[k] == from ? vertices[to].position : p[k];
+            }
+
+            glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+            glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+            if (glm::dot(before, after) <= 0.25f * glm::length(before) * glm::length(after)) return true;
+        }
+        return false;
+    }
+}
+
+float MeshSimplifier::Simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+    size_t targetIndexCount, float maxError, std::vector<unsigned int>& outIndices) {
+    outIndices.assign(indices.begin(), indices.begin() + indices.size() / 3 * 3);
+    const size_t vertexCount = vertices.size();
+    if (outIndices.size() <= targetIndexCount || vertexCount == 0) return 0.0f;
+
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t t = 0; t < outIndices.size(); t += 3) {
+        glm::dvec3 p0 = vertices[outIndices[t]].position;
+        glm::dvec3 p1 = vertices[outIndices[t + 1]].position;
+        glm::dvec3 p2 = vertices[outIndices[t + 2]].position;
+
+        glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+        double length = glm::length(normal);
+        if (length <= 0.0) continue;
+        normal /= length;
+
+        Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, p0), length * 0.5);
+        for (int k = 0; k < 3; ++k) quadrics[outIndices[t + k]] += plane;
+    }
+
+    std::vector<uint8_t> locked;
+    FindLockedVertices(vertices, outIndices, locked);
+
+    const float maxCost = maxError * maxError;
+    float worstCost = 0.0f;
+
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+    std::vector<uint32_t> offsets(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> candidates;
+
+    // Each pass collapses the cheapest edges that do not share a
+    // neighbourhood, then rebuilds the index list
+    while (outIndices.size() > targetIndexCount) {
+        const size_t triangleCount = outIndices.size() / 3;
+
+        std::fill(offsets.begin(), offsets.end(), 0u);
+        for (unsigned int index : outIndices) offsets[index + 1]++;
+        for (size_t v = 0; v < vertexCount; ++v) offsets[v + 1] += offsets[v];
+        adjacency.resize(outIndices.size());
+        {
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < outIndices.size(); ++i) {
+                adjacency[cursor[outIndices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        candidates.clear();
+        for (size_t i = 0; i < outIndices.size(); ++i) {
+            uint32_t a = outIndices[i];
+            uint32_t b = outIndices[i - i % 3 + (i % 3 + 1) % 3];
+
+            for (auto [from, to] : { std::pair{ a, b }, std::pair{ b, a } }) {
+                if (locked[from]) continue;
+
+                Quadric merged = quadrics[from];
+                merged += quadrics[to];
+                float cost = static_cast<float>(std::max(merged.Evaluate(vertices[to].position), 0.0));
+                if (cost <= maxCost) candidates.push_back({ cost, from, to });
+            }
+        }
+        if (candidates.empty()) break;
+
+        std::sort(candidates.begin(), candidates.end(),
+            [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+        std::iota(remap.begin(), remap.end(), 0u);
+        std::fill(touched.begin(), touched.end(), uint8_t(0));
+
+        const size_t toRemove = (outIndices.size() - targetIndexCount + 2) / 3;
+        size_t removed = 0;
+        size_t collapsed = 0;
+
+        for (const Collapse& collapse : candidates) {
+            if (removed >= toRemove) break;
+            if (touched[collapse.from] || touched[collapse.to]) continue;
+
+            const uint32_t* triangles = adjacency.data() + offsets[collapse.from];
+            uint32_t count = offsets[collapse.from + 1] - offsets[collapse.from];
+            if (FlipsTriangles(vertices, outIndices, triangles, count, collapse.from, collapse.to)) continue;
+
+            remap[collapse.from] = collapse.to;
+            quadrics[collapse.to] += quadrics[collapse.from];
+            worstCost = std::max(worstCost, collapse.cost);
+            collapsed++;
+
+            for (uint32_t i = 0; i < count; ++i) {
+                const unsigned int* tri = &outIndices[static_cast<size_t>(triangles[i]) * 3];
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+                if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to) removed++;
+            }
+        }
+        if (collapsed == 0) break;
+
+        size_t write = 0;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            uint32_t a = remap[outIndices[t * 3]];
+            uint32_t b = remap[outIndices[t * 3 + 1]];
+            uint32_t c = remap[outIndices[t * 3 + 2]];
+            if (a == b || b == c || a == c) continue;
+
+            outIndices[write++] = a;
+            outIndices[write++] = b;
+            outIndices[write++] = c;
+        }
+        outIndices.resize(write);
+    }
+
+    return std::sqrt(worstCost);
+}
+
+void MeshSimplifier::CompactVertices(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+    std::vector<Vertex>& outVertices, std::vector<unsigned int>& outIndices) {
+    std::vector<uint32_t> remap(vertices.size(), UINT32_MAX);
+    outVertices.clear();
+    outIndices.resize(indices.size());
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        uint32_t& mapped = remap[indices[i]];
+        if (mapped == UINT32_MAX) {
+            mapped = static_cast<uint32_t>(outVertices.size());
+            outVertices.push_back(vertices[indices[i]]);
+        }
+        outIndices[i] = mapped;
+    }
+}
+
+float MeshSimplifier::GetSphereError(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments) {
+    // Deepest point is the middle of a grid quad, half a step away in both directions
+    float halfLongitude = glm::pi<float>() / static_cast<float>(std::max(longitudeSegments, 3u));
+    float halfLatitude = glm::pi<float>() / static_cast<float>(2 * std::max(latitudeSegments, 2u));
+    return radius * (1.0f - std::cos(halfLongitude) * std::cos(halfLatitude));
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef MESH_LOD_H
+#define MESH_LOD_H
+
+#include "../common.h"
+#include "vertex.h"
+#include "frame_snapshot.h"
+#include "culling.h"
+
+class Mesh;
+class ThreadPool;
+
+constexpr uint32_t MAX_MESH_LODS = 4;
+constexpr size_t MESH_SLOT_COUNT = RENDER_SHAPE_COUNT * MAX_MESH_LODS;
+
+// Index into the per frame mesh table, this is what the mesh field of a
+// draw key holds
+inline uint32_t GetMeshSlot(RenderShape shape, uint32_t level) {
+    return static_cast<uint32_t>(shape) * MAX_MESH_LODS + level;
+}
+
+struct MeshLod {
+    Mesh* mesh = nullptr;
+    float error = 0.0f;     // object space distance to the full detail surface
+};
+
+// Level 0 is the full mesh, every further level is coarser and has a larger error
+class MeshLodChain {
+private:
+    std::array<MeshLod, MAX_MESH_LODS> _levels{};
+    uint32_t _count = 0;
+
+public:
+    void Clear() { _levels = {}; _count = 0; }
+
+    // Fails once the chain is full
+    bool AddLevel(Mesh* mesh, float error);
+
+    // Coarsest level whose error projects to at most thresholdPixels. Starting
+    // from 'current', the chain only refines once the error of the current
+    // level exceeds the threshold by the hysteresis fraction and only coarsens
+    // once the next level is that far below it, so objects near a boundary do
+    // not flicker between levels.
+    uint32_t Select(float pixelsPerUnit, float thresholdPixels, float hysteresis, uint32_t current) const;
+
+    uint32_t GetCount() const { return _count; }
+    const MeshLod& GetLevel(uint32_t level) const { return _levels[level]; }
+};
+
+struct LodSelectParams {
+    glm::vec3 cameraPos{ 0.0f };
+    float projectionScale = 1.0f;   // pixels per unit at distance 1, height / (2 tan(fovY / 2))
+    float nearPlane = 0.1f;
+    float thresholdPixels = 1.0f;
+    float hysteresis = 0.25f;
+};
+
+struct LodStats {
+    std::array<uint32_t, MAX_MESH_LODS> objectsPerLevel{};
+    uint32_t switches = 0;
+    uint64_t selectedTriangles = 0;
+    uint64_t fullTriangles = 0;     // what the same objects cost at level 0
+};
+
+// Picks a level of every snapshot object from its projected error. The
+// previous choice is kept per object index and reused while the object ID
+// at that index stays the same.
+class LodSelector {
+private:
+    std::vector<uint8_t> _levels;
+    std::vector<int> _objectIDs;
+    std::vector<uint8_t> _previousLevels;
+    std::vector<int> _previousIDs;
+    LodStats _stats;
+
+public:
+    void Select(const std::vector<RenderObjectSnapshot>& objects, const CullingBounds& bounds,
+        const std::array<MeshLodChain, RENDER_SHAPE_COUNT>& chains, const LodSelectParams& params,
+        ThreadPool* pool = nullptr);
+
+    void Reset();
+
+    const std::vector<uint8_t>& GetLevels() const { return _levels; }
+    const LodStats& GetStats() const { return _stats; }
+};
+
+// Quadric error edge collapse. Vertices are never moved, an edge collapses
+// into one of its endpoints so the attributes stay exact, and vertices on
+// open borders or attribute seams are never removed. Returns the largest
+// collapse error, the area weighted RMS distance from the planes of the
+// input triangles that were merged.
+namespace MeshSimplifier {
+    float Simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+        size_t targetIndexCount, float maxError, std::vector<unsigned int>& outIndices);
+
+    // Drops vertices the indices no longer reference
+    void CompactVertices(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+        std::vector<Vertex>& outVertices, std::vector<unsigned int>& outIndices);
+
+    // Largest distance between a StaticMeshes sphere and the true sphere
+    float GetSphereError(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments);
+}
+
+#endif // MESH_LOD_H
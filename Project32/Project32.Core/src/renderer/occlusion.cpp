@@ -0,0 +1,290 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "occlusion.h"
+#include "../core/job_system.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define OCCLUSION_SSE 1
+#include <immintrin.h>
+#endif
+
+namespace {
+    // Corners of the unit cube are indexed by bit 0 = x, bit 1 = y, bit 2 = z
+    constexpr int BOX_FACES[6][4] = {
+        { 0, 2, 6, 4 }, { 1, 5, 7, 3 },
+        { 0, 4, 5, 1 }, { 2, 3, 7, 6 },
+        { 0, 1, 3, 2 }, { 4, 6, 7, 5 }
+    };
+
+    // Pixel position with row 0 at the bottom, like gl_FragCoord, and 1/w
+    glm::vec3 ToScreen(const glm::vec4& clip) {
+        float invW = 1.0f / clip.w;
+        return glm::vec3(
+            (clip.x * invW * 0.5f + 0.5f) * static_cast<float>(OcclusionCuller::WIDTH),
+            (clip.y * invW * 0.5f + 0.5f) * static_cast<float>(OcclusionCuller::HEIGHT),
+            invW);
+    }
+}
+
+OcclusionCuller::OcclusionCuller()
+    : _depth(WIDTH * HEIGHT, 0.0f)
+    , _tileFarthest(TILES_X * TILES_Y, 0.0f)
+{
+}
+
+void OcclusionCuller::Begin(const glm::mat4& viewProjection, float nearPlane) {
+    _viewProjection = viewProjection;
+    _nearPlane = std::max(nearPlane, 0.001f);
+    _triangles.clear();
+    _stats = {};
+}
+
+void OcclusionCuller::AddBoxOccluder(const glm::mat4& model) {
+    glm::mat4 mvp = _viewProjection * model;
+
+    std::array<glm::vec4, 8> corners;
+    for (int i = 0; i < 8; ++i) {
+        corners[i] = mvp * glm::vec4(
+            (i & 1) ? 0.5f : -0.5f,
+            (i & 2) ? 0.5f : -0.5f,
+            (i & 4) ? 0.5f : -0.5f,
+            1.0f);
+    }
+
+    for (const auto& face : BOX_FACES) {
+        AddTriangle(corners[face[0]], corners[face[1]], corners[face[2]]);
+        AddTriangle(corners[face[0]], corners[face[2]], corners[face[3]]);
+    }
+    ++_stats.occluders;
+}
+
+void OcclusionCuller::AddTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c) {
+    if (a.w < _nearPlane || b.w < _nearPlane || c.w < _nearPlane) return;
+
+    glm::vec3 v[3] = { ToScreen(a), ToScreen(b), ToScreen(c) };
+
+    float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+    if (std::abs(area) < 1e-6f) return;
+
+    // Both facings are drawn, the nearest surface wins the depth test anyway
+    if (area < 0.0f) {
+        std::swap(v[1], v[2]);
+        area = -area;
+    }
+
+    // Pixels whose centers fall inside the bounds
+    float minX = std::min({ v[0].x, v[1].x, v[2].x });
+    float maxX = std::max({ v[0].x, v[1].x, v[2].x });
+    float minY = std::min({ v[0].y, v[1].y, v[2].y });
+    float maxY = std::max({ v[0].y, v[1].y, v[2].y });
+
+    ScreenTriangle tri;
+    tri.minX = std::max(0, static_cast<int>(std::ceil(minX - 0.5f)));
+    tri.maxX = std::min(static_cast<int>(WIDTH) - 1, static_cast<int>(std::floor(maxX - 0.5f)));
+    tri.minY = std::max(0, static_cast<int>(std::ceil(minY - 0.5f)));
+    tri.maxY = std::min(static_cast<int>(HEIGHT) - 1, static_cast<int>(std::floor(maxY - 0.5f)));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) return;
+
+    // Edge e is opposite vertex e, so edge / area is that vertex's weight
+    glm::vec3 depthPlane(0.0f);
+    for (int e = 0; e < 3; ++e) {
+        const glm::vec3& p = v[(e + 1) % 3];
+        const glm::vec3& q = v[(e + 2) % 3];
+        float A = p.y - q.y;
+        float B = q.x - p.x;
+        float C = -(A * p.x + B * p.y);
+        tri.edges[e] = glm::vec3(A, B, C);
+        depthPlane += v[e].z * tri.edges[e];
+    }
+    tri.depthPlane = depthPlane / area;
+
+    _triangles.push_back(tri);
+    ++_stats.triangles;
+}
+
+void OcclusionCuller::RasterizeBand(uint32_t band, bool simd) {
+    const int rowFirst = static_cast<int>(band * TILE_SIZE);
+    const int rowLast = rowFirst + static_cast<int>(TILE_SIZE) - 1;
+    std::fill(_depth.begin() + rowFirst * WIDTH, _depth.begin() + (rowLast + 1) * WIDTH, 0.0f);
+
+    for (const ScreenTriangle& tri : _triangles) {
+        int y0 = std::max(tri.minY, rowFirst);
+        int y1 = std::min(tri.maxY, rowLast);
+        if (y0 > y1) continue;
+
+        const glm::vec3& e0 = tri.edges[0];
+        const glm::vec3& e1 = tri.edges[1];
+        const glm::vec3& e2 = tri.edges[2];
+        const glm::vec3& dz = tri.depthPlane;
+
+        for (int y = y0; y <= y1; ++y) {
+            float py = static_cast<float>(y) + 0.5f;
+            float* row = &_depth[y * WIDTH];
+
+#if defined(OCCLUSION_SSE)
+            if (simd) {
+                // Row constant parts, x is added per group of four pixels
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 lanes = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+                const __m128 c0 = _mm_set1_ps(e0.y * py + e0.z);
+                const __m128 c1 = _mm_set1_ps(e1.y * py + e1.z);
+                const __m128 c2 = _mm_set1_ps(e2.y * py + e2.z);
+                const __m128 cz = _mm_set1_ps(dz.y * py + dz.z);
+                const __m128 a0 = _mm_set1_ps(e0.x);
+                const __m128 a1 = _mm_set1_ps(e1.x);
+                const __m128 a2 = _mm_set1_ps(e2.x);
+                const __m128 az = _mm_set1_ps(dz.x);
+
+                for (int x = tri.minX & ~3; x <= tri.maxX; x += 4) {
+                    __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lanes);
+                    __m128 inside = _mm_and_ps(
+                        _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a0, px), c0), zero),
+                            _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a1, px), c1), zero)),
+                        _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a2, px), c2), zero));
+                    if (_mm_movemask_ps(inside) == 0) continue;
+
+                    __m128 z = _mm_add_ps(_mm_mul_ps(az, px), cz);
+                    __m128 old = _mm_loadu_ps(row + x);
+                    __m128 nearest = _mm_max_ps(old, z);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, old)));
+                }
+                continue;
+            }
+#endif
+
+            for (int x = tri.minX; x <= tri.maxX; ++x) {
+                float px = static_cast<float>(x) + 0.5f;
+                if (e0.x * px + e0.y * py + e0.z < 0.0f) continue;
+                if (e1.x * px + e1.y * py + e1.z < 0.0f) continue;
+                if (e2.x * px + e2.y * py + e2.z < 0.0f) continue;
+
+                float z = dz.x * px + dz.y * py + dz.z;
+                row[x] = std::max(row[x], z);
+            }
+        }
+    }
+
+    for (uint32_t tx = 0; tx < TILES_X; ++tx) {
+        float farthest = std::numeric_limits<float>::max();
+        for (int y = rowFirst; y <= rowLast; ++y) {
+            const float* pixels = &_depth[y * WIDTH + tx * TILE_SIZE];
+            for (uint32_t x = 0; x < TILE_SIZE; ++x) {
+                farthest = std::min(farthest, pixels[x]);
+            }
+        }
+        _tileFarthest[band * TILES_X + tx] = farthest;
+    }
+}
+
+void OcclusionCuller::Rasterize(ThreadPool* pool) {
+    bool simd = FrustumCuller::GetActivePath() != CullingPath::Scalar;
+
+    if (pool) {
+        pool->ParallelFor(0, TILES_Y, 1, [this, simd](size_t band) {
+            RasterizeBand(static_cast<uint32_t>(band), simd);
+            });
+    }
+    else {
+        for (uint32_t band = 0; band < TILES_Y; ++band) {
+            RasterizeBand(band, simd);
+        }
+    }
+}
+
+bool OcclusionCuller::IsOccluded(const glm::vec3& center, float radius) const {
+    if (_triangles.empty()) return false;
+
+    glm::vec4 clipCenter = _viewProjection * glm::vec4(center, 1.0f);
+    float nearest = clipCenter.w - radius;
+    if (nearest <= _nearPlane) return false;
+
+    // Screen rectangle of the sphere's bounding box, clip space is linear so
+    // the corners are offsets along the matrix columns
+    glm::vec4 axisX = _viewProjection[0] * radius;
+    glm::vec4 axisY = _viewProjection[1] * radius;
+    glm::vec4 axisZ = _viewProjection[2] * radius;
+
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (int i = 0; i < 8; ++i) {
+        glm::vec4 corner = clipCenter
+            + ((i & 1) ? axisX : -axisX)
+            + ((i & 2) ? axisY : -axisY)
+            + ((i & 4) ? axisZ : -axisZ);
+        if (corner.w <= _nearPlane) return false;
+
+        glm::vec3 screen = ToScreen(corner);
+        minX = std::min(minX, screen.x);
+        maxX = std::max(maxX, screen.x);
+        minY = std::min(minY, screen.y);
+        maxY = std::max(maxY, screen.y);
+    }
+
+    int x0 = std::max(0, static_cast<int>(std::floor(minX)));
+    int x1 = std::min(static_cast<int>(WIDTH) - 1, static_cast<int>(std::floor(maxX)));
+    int y0 = std::max(0, static_cast<int>(std::floor(minY)));
+    int y1 = std::min(static_cast<int>(HEIGHT) - 1, static_cast<int>(std::floor(maxY)));
+    if (x0 > x1 || y0 > y1) return false;
+
+    const float depth = 1.0f / nearest;
+    for (int ty = y0 / static_cast<int>(TILE_SIZE); ty <= y1 / static_cast<int>(TILE_SIZE); ++ty) {
+        for (int tx = x0 / static_cast<int>(TILE_SIZE); tx <= x1 / static_cast<int>(TILE_SIZE); ++tx) {
+            if (_tileFarthest[ty * TILES_X + tx] > depth) continue;
+
+            // Tile is not closer everywhere, look at the covered pixels
+            int px0 = std::max(x0, tx * static_cast<int>(TILE_SIZE));
+            int px1 = std::min(x1, (tx + 1) * static_cast<int>(TILE_SIZE) - 1);
+            int py0 = std::max(y0, ty * static_cast<int>(TILE_SIZE));
+            int py1 = std::min(y1, (ty + 1) * static_cast<int>(TILE_SIZE) - 1);
+            for (int y = py0; y <= py1; ++y) {
+                const float* row = &_depth[y * WIDTH];
+                for (int x = px0; x <= px1; ++x) {
+                    if (row[x] <= depth) return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void OcclusionCuller::Cull(const CullingBounds& bounds, std::vector<uint32_t>& visible, ThreadPool* pool) {
+    const size_t count = visible.size();
+    _stats.tested = static_cast<uint32_t>(count);
+    _stats.occluded = 0;
+    if (count == 0 || _triangles.empty()) return;
+
+    _occluded.assign(count, 0);
+    auto test = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            uint32_t index = visible[i];
+            glm::vec3 center(bounds.centerX[index], bounds.centerY[index], bounds.centerZ[index]);
+            _occluded[i] = IsOccluded(center, bounds.radius[index]) ? 1 : 0;
+        }
+        };
+
+    if (pool) {
+        pool->ParallelForRange(0, count, pool->SuggestGrainSize(count, 64), test);
+    }
+    else {
+        test(0, count);
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!_occluded[i]) visible[kept++] = visible[i];
+    }
+    _stats.occluded = static_cast<uint32_t>(count - kept);
+    visible.resize(kept);
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include "../common.h"
+#include "culling.h"
+
+class ThreadPool;
+
+struct OcclusionStats {
+    uint32_t occluders = 0;
+    uint32_t triangles = 0;
+    uint32_t tested = 0;
+    uint32_t occluded = 0;
+};
+
+// Software occlusion culling against a small depth buffer. A budget of large
+// boxes is rasterized on the CPU, then bounding spheres are rejected when
+// every pixel they could touch already holds something closer. Depth is
+// stored as 1/w, which interpolates linearly in screen space: larger is
+// closer and 0 means nothing was drawn. The buffer is split into bands of
+// TILE_SIZE rows rasterized in parallel, four pixels at a time with SSE, and
+// each TILE_SIZE square keeps its farthest depth so most tests stop there.
+class OcclusionCuller {
+public:
+    static constexpr uint32_t WIDTH = 256;
+    static constexpr uint32_t HEIGHT = 144;
+    static constexpr uint32_t TILE_SIZE = 8;
+    static constexpr uint32_t TILES_X = WIDTH / TILE_SIZE;
+    static constexpr uint32_t TILES_Y = HEIGHT / TILE_SIZE;
+
+private:
+    static_assert(WIDTH % TILE_SIZE == 0 && HEIGHT % TILE_SIZE == 0, "Buffer must be whole tiles");
+    static_assert(WIDTH % 4 == 0, "Rows are rasterized four pixels at a time");
+
+    struct ScreenTriangle {
+        // Edge functions A * x + B * y + C, positive inside
+        glm::vec3 edges[3];
+        glm::vec3 depthPlane;   // 1/w as dzdx, dzdy, z0
+        int minX, maxX, minY, maxY;
+    };
+
+    std::vector<float> _depth;
+    std::vector<float> _tileFarthest;
+    std::vector<ScreenTriangle> _triangles;
+    std::vector<uint8_t> _occluded;
+
+    glm::mat4 _viewProjection{ 1.0f };
+    float _nearPlane = 0.1f;
+    OcclusionStats _stats;
+
+    void AddTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c);
+    void RasterizeBand(uint32_t band, bool simd);
+
+public:
+    OcclusionCuller();
+
+    // Clears the occluders, the buffer is rebuilt by Rasterize
+    void Begin(const glm::mat4& viewProjection, float nearPlane);
+
+    // Unit cube (-0.5..0.5) under the model matrix, triangles crossing the
+    // near plane are dropped, which only makes the culling less aggressive
+    void AddBoxOccluder(const glm::mat4& model);
+
+    void Rasterize(ThreadPool* pool = nullptr);
+
+    bool IsOccluded(const glm::vec3& center, float radius) const;
+
+    // Drops occluded entries of 'visible', the order of the rest is kept
+    void Cull(const CullingBounds& bounds, std::vector<uint32_t>& visible, ThreadPool* pool = nullptr);
+
+    const OcclusionStats& GetStats() const { return _stats; }
+    const std::vector<float>& GetDepth() const { return _depth; }
+};
+
+#endif // OCCLUSION_H
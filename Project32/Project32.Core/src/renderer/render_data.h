@@ -27,6 +27,17 @@ namespace RendererData
 		float farPlane{ 100.0f };
 		bool renderScene{ true };
 		bool wireframeMode{ false };
+		bool multiDrawIndirect{ true };
+		bool cascadedShadows{ true };
+		int shadowCascades{ 4 };
+		float shadowSplitLambda{ 0.75f };
+		float shadowDistance{ 100.0f };
+		bool shadowCaching{ true };
+		bool clusteredLighting{ true };
+		bool occlusionCulling{ true };
+		int occluderBudget{ 32 };
+		bool meshLods{ true };
+		float lodErrorPixels{ 1.0f };
 		bool showDebugInfo{ true };
 		bool showImGuiDemo{ false };
 		bool showSettingsWindow{ true };
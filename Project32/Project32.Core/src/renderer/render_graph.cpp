@@ -0,0 +1,360 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "render_graph.h"
+
+unsigned int RenderPassContext::GetTexture(RenderResource resource) const {
+    if (resource >= _graph->_resourceCount) return 0;
+    return _graph->_resources[resource].texture;
+}
+
+void RenderPassContext::BindTexture(RenderResource resource, int textureUnit) const {
+    if (resource >= _graph->_resourceCount) return;
+    const RenderGraph::ResourceNode& node = _graph->_resources[resource];
+    _pool->BindTexture(node.texture, node.desc, textureUnit);
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Reads(RenderResource resource) {
+    if (resource < _graph->_resourceCount) {
+        _graph->_passes[_index].reads.push_back(resource);
+    }
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Writes(RenderResource resource, LoadOp load, uint32_t layer) {
+    if (resource < _graph->_resourceCount) {
+        _graph->_passes[_index].writes.push_back({ resource, load, layer });
+    }
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::ClearColor(const glm::vec4& color) {
+    _graph->_passes[_index].clearColor = color;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::SideEffect() {
+    _graph->_passes[_index].sideEffect = true;
+    return *this;
+}
+
+void RenderGraph::Reset() {
+    // Nodes past the counts are reused by the next frame
+    _passCount = 0;
+    _resourceCount = 0;
+    _compiled = false;
+    _order.clear();
+    _stats = {};
+}
+
+RenderResource RenderGraph::AddResource(std::string name, const RenderTextureDesc& desc) {
+    if (_resourceCount == _resources.size()) _resources.emplace_back();
+
+    ResourceNode& node = _resources[_resourceCount];
+    node.name = std::move(name);
+    node.desc = desc;
+    node.texture = 0;
+    node.imported = false;
+    node.backbuffer = false;
+    node.state = ResourceState::Undefined;
+    node.writers.clear();
+    node.readers.clear();
+    return static_cast<RenderResource>(_resourceCount++);
+}
+
+RenderResource RenderGraph::CreateTexture(std::string name, const RenderTextureDesc& desc) {
+    return AddResource(std::move(name), desc);
+}
+
+RenderResource RenderGraph::ImportTexture(std::string name, const RenderTextureDesc& desc, unsigned int texture) {
+    RenderResource resource = AddResource(std::move(name), desc);
+    _resources[resource].texture = texture;
+    _resources[resource].imported = true;
+    return resource;
+}
+
+RenderResource RenderGraph::ImportBackbuffer(uint32_t width, uint32_t height) {
+    RenderTextureDesc desc;
+    desc.width = width;
+    desc.height = height;
+
+    RenderResource resource = ImportTexture("Backbuffer", desc, 0);
+    _resources[resource].backbuffer = true;
+    return resource;
+}
+
+RenderGraph::PassBuilder RenderGraph::AddPass(std::string name, PassFn fn) {
+    if (_passCount == _passes.size()) _passes.emplace_back();
+
+    PassNode& pass = _passes[_passCount];
+    pass.name = std::move(name);
+    pass.fn = std::move(fn);
+    pass.reads.clear();
+    pass.writes.clear();
+    pass.clearColor = glm::vec4(0.0f);
+    pass.sideEffect = false;
+    pass.culled = false;
+    pass.dependents.clear();
+    pass.dependencyCount = 0;
+    pass.acquires.clear();
+    pass.releases.clear();
+    return PassBuilder(this, _passCount++);
+}
+
+bool RenderGraph::Writes(const PassNode& pass, RenderResource resource) const {
+    for (const PassWrite& write : pass.writes) {
+        if (write.resource == resource) return true;
+    }
+    return false;
+}
+
+uint32_t RenderGraph::GetWriterBefore(const ResourceNode& resource, uint32_t pass) {
+    auto it = std::lower_bound(resource.writers.begin(), resource.writers.end(), pass);
+    return it == resource.writers.begin() ? UINT32_MAX : *(it - 1);
+}
+
+uint32_t RenderGraph::GetWriterAfter(const ResourceNode& resource, uint32_t pass) {
+    auto it = std::upper_bound(resource.writers.begin(), resource.writers.end(), pass);
+    return it == resource.writers.end() ? UINT32_MAX : *it;
+}
+
+void RenderGraph::CullPasses() {
+    // Walks back from the passes with visible output, a pass pulls in the
+    // writer of the version it reads and, when it keeps the old contents,
+    // the writers of its attachments that ran before it
+    _worklist.clear();
+    for (uint32_t i = 0; i < _passCount; ++i) {
+        PassNode& pass = _passes[i];
+        pass.culled = !pass.sideEffect;
+        for (const PassWrite& write : pass.writes) {
+            if (_resources[write.resource].imported) pass.culled = false;
+        }
+        if (!pass.culled) _worklist.push_back(i);
+    }
+
+    auto keep = [this](uint32_t index) {
+        if (!_passes[index].culled) return;
+        _passes[index].culled = false;
+        _worklist.push_back(index);
+    };
+
+    while (!_worklist.empty()) {
+        uint32_t index = _worklist.back();
+        _worklist.pop_back();
+        const PassNode& pass = _passes[index];
+
+        for (RenderResource resource : pass.reads) {
+            if (Writes(pass, resource)) continue;
+            uint32_t writer = GetWriterBefore(_resources[resource], index);
+            if (writer != UINT32_MAX) keep(writer);
+        }
+        for (const PassWrite& write : pass.writes) {
+            if (write.load != LoadOp::Load) continue;
+            for (uint32_t writer : _resources[write.resource].writers) {
+                if (writer >= index) break;
+                keep(writer);
+            }
+        }
+    }
+}
+
+bool RenderGraph::SortPasses() {
+    // Culled passes stay in the sort so the order between the passes around
+    // them still holds
+    auto addEdge = [this](uint32_t from, uint32_t to) {
+        if (from == to) return;
+        _passes[from].dependents.push_back(to);
+        ++_passes[to].dependencyCount;
+    };
+
+    // A reader follows the writer of its version and comes before the
+    // writer that replaces it
+    for (size_t r = 0; r < _resourceCount; ++r) {
+        const ResourceNode& resource = _resources[r];
+        for (size_t w = 1; w < resource.writers.size(); ++w) {
+            addEdge(resource.writers[w - 1], resource.writers[w]);
+        }
+        for (uint32_t reader : resource.readers) {
+            uint32_t before = GetWriterBefore(resource, reader);
+            uint32_t after = GetWriterAfter(resource, reader);
+            if (before != UINT32_MAX) addEdge(before, reader);
+            if (after != UINT32_MAX) addEdge(reader, after);
+        }
+    }
+
+    // Kahn's algorithm, always taking the earliest declared ready pass so
+    // independent passes keep the order they were added in
+    _worklist.clear();
+    for (uint32_t i = 0; i < _passCount; ++i) {
+        if (_passes[i].dependencyCount == 0) _worklist.push_back(i);
+    }
+
+    size_t placed = 0;
+    while (!_worklist.empty()) {
+        auto next = std::min_element(_worklist.begin(), _worklist.end());
+        uint32_t index = *next;
+        *next = _worklist.back();
+        _worklist.pop_back();
+
+        ++placed;
+        if (!_passes[index].culled) _order.push_back(index);
+
+        for (uint32_t dependent : _passes[index].dependents) {
+            if (--_passes[dependent].dependencyCount == 0) _worklist.push_back(dependent);
+        }
+    }
+
+    if (placed == _passCount) return true;
+
+    _order.clear();
+    for (uint32_t i = 0; i < _passCount; ++i) {
+        if (!_passes[i].culled) _order.push_back(i);
+    }
+    return false;
+}
+
+void RenderGraph::AssignLifetimes() {
+    // First and last position in the order for every transient resource
+    constexpr uint32_t UNUSED = UINT32_MAX;
+    _worklist.assign(_resourceCount * 2, UNUSED);
+
+    auto touch = [this](RenderResource resource, uint32_t position) {
+        if (_resources[resource].imported) return;
+        uint32_t& first = _worklist[resource * 2];
+        uint32_t& last = _worklist[resource * 2 + 1];
+        if (first == UNUSED) first = position;
+        last = position;
+    };
+
+    for (uint32_t position = 0; position < _order.size(); ++position) {
+        const PassNode& pass = _passes[_order[position]];
+        for (RenderResource resource : pass.reads) touch(resource, position);
+        for (const PassWrite& write : pass.writes) touch(write.resource, position);
+    }
+
+    for (uint32_t r = 0; r < _resourceCount; ++r) {
+        uint32_t first = _worklist[r * 2];
+        if (first == UNUSED) continue;
+
+        _passes[_order[first]].acquires.push_back(r);
+        _passes[_order[_worklist[r * 2 + 1]]].releases.push_back(r);
+
+        ++_stats.transientTextures;
+        _stats.transientBytes += _resources[r].desc.GetSizeBytes();
+    }
+}
+
+bool RenderGraph::Compile() {
+    for (uint32_t i = 0; i < _passCount; ++i) {
+        const PassNode& pass = _passes[i];
+        for (const PassWrite& write : pass.writes) {
+            std::vector<uint32_t>& writers = _resources[write.resource].writers;
+            if (writers.empty() || writers.back() != i) writers.push_back(i);
+        }
+        for (RenderResource resource : pass.reads) {
+            std::vector<uint32_t>& readers = _resources[resource].readers;
+            if (!Writes(pass, resource) && (readers.empty() || readers.back() != i)) readers.push_back(i);
+        }
+    }
+
+    CullPasses();
+    bool sorted = SortPasses();
+    if (!sorted) {
+        spdlog::error("[RenderGraph::Compile] Passes depend on each other in a cycle, running them in declaration order");
+    }
+    AssignLifetimes();
+
+    _stats.passes = static_cast<uint32_t>(_order.size());
+    _stats.culledPasses = static_cast<uint32_t>(_passCount - _order.size());
+    _compiled = true;
+    return sorted;
+}
+
+void RenderGraph::Transition(RenderResource resource, ResourceState state) {
+    // GL tracks hazards between passes itself, the transitions only show up
+    // in the stats
+    ResourceNode& node = _resources[resource];
+    if (node.state == state) return;
+    node.state = state;
+    ++_stats.transitions;
+}
+
+void RenderGraph::Execute(RenderTargetPool& pool) {
+    if (!_compiled) Compile();
+
+    _physical.clear();
+    RenderPassContext context(this, &pool);
+
+    for (uint32_t index : _order) {
+        PassNode& pass = _passes[index];
+
+        for (RenderResource resource : pass.acquires) {
+            ResourceNode& node = _resources[resource];
+            node.texture = pool.Acquire(node.desc);
+            if (std::find(_physical.begin(), _physical.end(), node.texture) == _physical.end()) {
+                _physical.push_back(node.texture);
+                ++_stats.physicalTextures;
+                _stats.physicalBytes += node.desc.GetSizeBytes();
+            }
+        }
+
+        for (RenderResource resource : pass.reads) {
+            if (!Writes(pass, resource)) Transition(resource, ResourceState::ShaderRead);
+        }
+
+        if (!pass.writes.empty()) {
+            RenderAttachments attachments;
+            attachments.clearColor = pass.clearColor;
+
+            for (const PassWrite& write : pass.writes) {
+                Transition(write.resource, ResourceState::RenderTarget);
+                const ResourceNode& node = _resources[write.resource];
+                attachments.width = node.desc.width;
+                attachments.height = node.desc.height;
+
+                RenderAttachment attachment;
+                attachment.texture = node.texture;
+                attachment.layer = write.layer;
+                attachment.array = node.desc.array;
+                attachment.load = write.load;
+
+                if (node.backbuffer) {
+                    // Color and depth of the default framebuffer
+                    attachments.backbuffer = true;
+                    attachments.colors[0] = attachment;
+                    attachments.colorCount = 1;
+                    attachments.depth = attachment;
+                    attachments.hasDepth = true;
+                }
+                else if (node.desc.IsDepth()) {
+                    attachments.depth = attachment;
+                    attachments.hasDepth = true;
+                }
+                else if (attachments.colorCount < MAX_COLOR_ATTACHMENTS) {
+                    attachments.colors[attachments.colorCount++] = attachment;
+                }
+                else {
+                    spdlog::warn("[RenderGraph::Execute] Pass '{}' writes more than {} color targets", pass.name, MAX_COLOR_ATTACHMENTS);
+                }
+            }
+            pool.BeginPass(attachments);
+        }
+
+        if (pass.fn) pass.fn(context);
+
+        for (RenderResource resource : pass.releases) {
+            pool.Release(_resources[resource].texture);
+        }
+    }
+
+    pool.EndFrame();
+}
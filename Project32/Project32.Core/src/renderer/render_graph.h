@@ -0,0 +1,176 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+#include "../common.h"
+#include "../BackEnd/OpenGL/Types/GL_render_targets.h"
+
+using RenderResource = uint32_t;
+constexpr RenderResource INVALID_RENDER_RESOURCE = UINT32_MAX;
+
+class RenderGraph;
+
+enum class ResourceState : uint8_t {
+    Undefined,
+    RenderTarget,
+    ShaderRead
+};
+
+struct RenderGraphStats {
+    uint32_t passes = 0;
+    uint32_t culledPasses = 0;
+    uint32_t transitions = 0;           // resource state changes between passes
+    uint32_t transientTextures = 0;     // declared by passes that ran
+    uint32_t physicalTextures = 0;      // distinct pooled textures behind them
+    size_t transientBytes = 0;          // what the transient textures take without aliasing
+    size_t physicalBytes = 0;
+};
+
+// What a pass body can reach while it runs
+class RenderPassContext {
+private:
+    const RenderGraph* _graph;
+    RenderTargetPool* _pool;
+
+public:
+    RenderPassContext(const RenderGraph* graph, RenderTargetPool* pool) : _graph(graph), _pool(pool) {}
+
+    unsigned int GetTexture(RenderResource resource) const;
+    void BindTexture(RenderResource resource, int textureUnit) const;
+};
+
+// GPU passes declare the textures they render to and sample from, the
+// graph derives the rest:
+//  - every write starts a new version of a texture. A read sees the version
+//    of the last writer declared before it and runs before the next one, so
+//    ping-pong chains need no extra textures. Writers of one texture keep
+//    their declaration order.
+//  - passes whose output nothing uses are culled, writing the backbuffer
+//    or an imported texture counts as a use
+//  - a transient texture holds a pooled texture only from its first to its
+//    last pass, textures with disjoint lifetimes share one allocation
+// Built again every frame, the node lists keep their capacity.
+class RenderGraph {
+public:
+    using PassFn = std::function<void(RenderPassContext&)>;
+
+    class PassBuilder {
+    private:
+        RenderGraph* _graph;
+        size_t _index;
+
+    public:
+        PassBuilder(RenderGraph* graph, size_t index) : _graph(graph), _index(index) {}
+
+        PassBuilder& Reads(RenderResource resource);
+
+        // Attaches the resource, one layer of it for array textures. Clear
+        // and DontCare drop what earlier passes wrote.
+        PassBuilder& Writes(RenderResource resource, LoadOp load = LoadOp::Load, uint32_t layer = 0);
+        PassBuilder& ClearColor(const glm::vec4& color);
+
+        // Kept even when nothing uses what it writes
+        PassBuilder& SideEffect();
+    };
+
+    RenderGraph() = default;
+
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    // Drops the passes and resources of the previous frame
+    void Reset();
+
+    RenderResource CreateTexture(std::string name, const RenderTextureDesc& desc);
+    RenderResource ImportTexture(std::string name, const RenderTextureDesc& desc, unsigned int texture);
+    RenderResource ImportBackbuffer(uint32_t width, uint32_t height);
+
+    PassBuilder AddPass(std::string name, PassFn fn);
+
+    // Orders and culls the passes and works out resource lifetimes. On a
+    // dependency cycle the passes keep their declaration order and this
+    // returns false.
+    bool Compile();
+
+    void Execute(RenderTargetPool& pool);
+
+    const RenderGraphStats& GetStats() const { return _stats; }
+    size_t GetPassCount() const { return _passCount; }
+    const std::string& GetPassName(size_t index) const { return _passes[index].name; }
+    bool IsPassCulled(size_t index) const { return _passes[index].culled; }
+
+    // Pass indices in the order they run, culled passes left out
+    const std::vector<uint32_t>& GetExecutionOrder() const { return _order; }
+
+private:
+    friend class RenderPassContext;
+
+    struct ResourceNode {
+        std::string name;
+        RenderTextureDesc desc;
+        unsigned int texture = 0;
+        bool imported = false;
+        bool backbuffer = false;
+        ResourceState state = ResourceState::Undefined;
+        std::vector<uint32_t> writers;      // declaration order
+        std::vector<uint32_t> readers;      // passes that read without writing
+    };
+
+    struct PassWrite {
+        RenderResource resource;
+        LoadOp load;
+        uint32_t layer;
+    };
+
+    struct PassNode {
+        std::string name;
+        PassFn fn;
+        std::vector<RenderResource> reads;
+        std::vector<PassWrite> writes;
+        glm::vec4 clearColor{ 0.0f };
+        bool sideEffect = false;
+        bool culled = false;
+
+        std::vector<uint32_t> dependents;
+        uint32_t dependencyCount = 0;
+        std::vector<RenderResource> acquires;   // transients whose first use is this pass
+        std::vector<RenderResource> releases;   // and whose last use is
+    };
+
+    std::vector<PassNode> _passes;
+    std::vector<ResourceNode> _resources;
+    size_t _passCount = 0;
+    size_t _resourceCount = 0;
+    bool _compiled = false;
+
+    std::vector<uint32_t> _order;
+    std::vector<uint32_t> _worklist;
+    std::vector<unsigned int> _physical;
+    RenderGraphStats _stats;
+
+    RenderResource AddResource(std::string name, const RenderTextureDesc& desc);
+    bool Writes(const PassNode& pass, RenderResource resource) const;
+
+    // Last writer declared before the pass and first one after it,
+    // UINT32_MAX when there is none
+    static uint32_t GetWriterBefore(const ResourceNode& resource, uint32_t pass);
+    static uint32_t GetWriterAfter(const ResourceNode& resource, uint32_t pass);
+    void CullPasses();
+    bool SortPasses();
+    void AssignLifetimes();
+    void Transition(RenderResource resource, ResourceState state);
+};
+
+#endif // RENDER_GRAPH_H
@@ -23,8 +23,6 @@ Renderer::Renderer(Window* window)
     , m_backend(GraphicsBackend::Get())
     , m_backendType(BackendType::UNDEFINED)
     , m_sceneManager(SceneManager::Instance())
-    , m_shaderManager(nullptr)
-    , m_textures(nullptr)
     , m_isReady(false)
 {
     if (!m_window) {
@@ -54,8 +52,14 @@ void Renderer::Init(BackendType backendType) {
         m_lightingSystem = std::make_unique<LightingSystem>();
         m_lightingSystem->SetupDefaultLighting();
 
-        m_textures = TextureFactory::CreateTextureManager();
-        m_shaderManager = ShaderFactory::CreateShaderManager();
+        // Vertex arrays and recorded draws belong to this window's context
+        GLStateCache* stateCache = m_window->GetStateCache();
+        m_contextSlot = stateCache ? stateCache->GetContextSlot() : GLStateCache::GetCurrent().GetContextSlot();
+        for (ShadowLayerPass& pass : m_shadowPasses) {
+            pass.commands.SetContextSlot(m_contextSlot);
+            pass.staticCommands.SetContextSlot(m_contextSlot);
+        }
+        m_sceneCommands.SetContextSlot(m_contextSlot);
 
         shadowMap = std::make_unique<ShadowMap>(2048, 2048);
         if (!shadowMap->Initialize()) {
@@ -63,21 +67,34 @@ void Renderer::Init(BackendType backendType) {
         }
 
         LoadShaders();
+        BuildFrameGraph();
+
+        m_instanceStream = std::make_unique<StreamBuffer>(INSTANCE_STREAM_REGION_SIZE);
+        if (!m_instanceStream->Initialize()) {
+            throw std::runtime_error("Failed to initialize instance stream buffer");
+        }
+
+        m_geometryArena = std::make_unique<GeometryArena>();
+        if (!m_geometryArena->Initialize()) {
+            m_geometryArena.reset();
+        }
+        CreateUniformBuffers();
+        CreateLightClusterBuffers();
 
         ScriptSystem* scriptSystem = EngineManager::Instance()->GetCurrentEngine()->GetScriptSystem();
         if (scriptSystem) {
             scriptSystem;
         }
 
-        m_meshCache.Add("cube", MeshFactory::CreateCube());
-
-        spdlog::info("[Renderer::Init()] Pre-loaded {} meshes", m_meshCache.Size());
+        CreateShapeLods();
 
-        size_t memUsage = m_meshCache.GetTotalMemoryUsage();
-        spdlog::info("[Renderer::Init] Total mesh memory: {} KB", memUsage / 1024);
+        const SharedResourceStats shared = SharedResources::Get().GetStats();
+        spdlog::info("[Renderer::Init] Shared resources: {} meshes ({} KB), {} shaders, {} textures, {} loads",
+            shared.meshes, shared.meshBytes / 1024, shared.shaders, shared.textures, shared.loads);
 
         spdlog::info("[Renderer::Init] Renderer initialized successfully for Window {}", m_window->GetID());
-        spdlog::info("[Renderer::Init] Backend: {}", m_backendType == BackendType::OPENGL ? "OpenGL" : "Unknown");
+        spdlog::info("[Renderer::Init] Backend: {}", m_backendType == BackendType::OPENGL ? "OpenGL" :
+            m_backendType == BackendType::Null ? "Null" : "Unknown");
         spdlog::info("[Renderer::Init] Window size: {}x{}", m_window->GetWidth(), m_window->GetHeight());
 
         m_isReady = true;
@@ -95,37 +112,14 @@ void Renderer::LoadShaders() {
         return;
     }
 
-    bool success = m_shaderManager->LoadShader("solidcolor",
-        "solidcolor.vert",
-        "solidcolor.frag");
-
-    if (success) {
-        spdlog::info("[Renderer::LoadShaders] Successfully loaded 'solidcolor' shader");
-    }
-    else {
-        spdlog::error("[Renderer::LoadShaders] Failed to load 'solidcolor' shader");
-    }
-
-    bool success2 = m_shaderManager->LoadShader("depth",
-        "shadow_depth.vert",
-        "shadow_depth.frag");
-
-    if (success2) {
-        spdlog::info("[Renderer::LoadShaders] Successfully loaded 'depth' shader");
-    }
-    else {
-        spdlog::error("[Renderer::LoadShaders] Failed to load 'depth' shader");
-    }
-
-    bool success3 = m_shaderManager->LoadShader("pbr",
-        "pbr_shadow.vert",
-        "pbr_shadow.frag");
+    // Programs are shared, only the first renderer in the process compiles them
+    SharedResources& shared = SharedResources::Get();
+    m_solidColorShader = shared.AcquireShader("solidcolor", "solidcolor.vert", "solidcolor.frag");
+    m_depthShader = shared.AcquireShader("depth", "shadow_depth.vert", "shadow_depth.frag");
+    m_pbrShader = shared.AcquireShader("pbr", "pbr_shadow.vert", "pbr_shadow.frag");
 
-    if (success3) {
-        spdlog::info("[Renderer::LoadShaders] Successfully loaded 'pbr' shader");
-    }
-    else {
-        spdlog::error("[Renderer::LoadShaders] Failed to load 'pbr' shader");
+    if (!m_solidColorShader || !m_depthShader || !m_pbrShader) {
+        spdlog::error("[Renderer::LoadShaders] Failed to load the renderer shaders");
     }
 }
 
@@ -147,39 +141,25 @@ void Renderer::RenderFrame() {
 
     float aspectRatio = static_cast<float>(width) / static_cast<float>(height);
 
-    auto depthShader = m_shaderManager->GetShader("depth");
-    auto pbrShader = m_shaderManager->GetShader("pbr");
+    Shader* depthShader = m_depthShader.get();
+    Shader* pbrShader = m_pbrShader.get();
 
     if (!depthShader || !pbrShader) {
         spdlog::error("[Renderer] Required shaders not loaded");
         return;
     }
 
-    glm::vec3 cameraPos = glm::vec3(0.0f, 1.7f, 5.0f);
-    glm::vec3 cameraRot = glm::vec3(0.0f, 0.0f, 0.0f);
-
-    if (m_window) {
-        Engine* engine = m_window->GetEngine();
-        if (engine) {
-            ScriptSystem* scripts = engine->GetScriptSystem();
-            if (scripts) {
-                auto* playerScript = scripts->GetScript(0);
-                if (playerScript && playerScript->IsLoaded()) {
-                    sol::table player = playerScript->GetScriptTable();
-
-                    if (player["isCamera"].valid() && player["isCamera"].get<bool>()) {
-                        if (player["cameraPosition"].valid()) {
-                            cameraPos = player["cameraPosition"].get<glm::vec3>();
-                        }
-                        if (player["cameraRotation"].valid()) {
-                            cameraRot = player["cameraRotation"].get<glm::vec3>();
-                        }
-                    }
-                }
-            }
-        }
+    Engine* engine = m_window->GetEngine();
+    if (!engine) {
+        spdlog::error("[Renderer] Window {} has no engine to render", m_window->GetID());
+        return;
     }
 
+    const FrameSnapshot& snapshot = engine->GetRenderSnapshot();
+
+    glm::vec3 cameraPos = snapshot.camera.position;
+    glm::vec3 cameraRot = snapshot.camera.rotation;
+
     float pitchRad = glm::radians(cameraRot.x);
     float yawRad = glm::radians(cameraRot.y);
 
@@ -188,266 +168,870 @@ void Renderer::RenderFrame() {
     forward.y = -sin(pitchRad);
     forward.z = -cos(pitchRad) * cos(yawRad);
 
-    glm::vec3 target = cameraPos + glm::normalize(forward);
+    forward = glm::normalize(forward);
+    glm::vec3 target = cameraPos + forward;
     glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
 
-    glm::mat4 view = glm::lookAt(cameraPos, target, up);
-    glm::mat4 projection = glm::perspective(
-        glm::radians(90.0f),
+    m_frame.snapshot = &snapshot;
+    m_frame.depthShader = depthShader;
+    m_frame.pbrShader = pbrShader;
+    m_frame.width = width;
+    m_frame.height = height;
+    m_frame.cameraPos = cameraPos;
+    m_frame.cameraRot = cameraRot;
+    m_frame.cameraForward = forward;
+    m_frame.view = glm::lookAt(cameraPos, target, up);
+    m_frame.aspect = aspectRatio;
+    m_frame.projection = glm::perspective(
+        m_frame.fovY,
         aspectRatio,
-        0.1f, 1000.0f
+        m_frame.nearPlane, m_frame.farPlane
     );
 
-    glm::vec3 lightPos(5.0f, 10.0f, 5.0f);
-    glm::vec3 lightTarget(0.0f, 2.0f, 0.0f);
+    m_frame.deltaTime = snapshot.deltaTime;
+    m_frame.time += snapshot.deltaTime;
+    m_frame.frameIndex = snapshot.frameIndex;
+
+    // The shadow map follows the first shadow casting light
+    if (const Light* caster = m_lightingSystem->GetShadowCaster()) {
+        m_frame.lightPos = caster->position;
+        m_frame.lightTarget = caster->position + glm::normalize(caster->direction);
+    }
+    m_frame.lightDirection = glm::normalize(m_frame.lightTarget - m_frame.lightPos);
+
+    // Copied here so the cluster build never reads the lighting system
+    if (m_settings.clusteredLighting) m_lightingSystem->FillClusteredLights(m_clusterLights);
+    else m_clusterLights.clear();
+
+    // Everything that talks to the backend outside of Submit is resolved
+    // here, the recording systems may run on any worker. Shared meshes get
+    // the vertex arrays of this context before any draw is recorded.
+    GLStateCache::GetCurrent().DeleteQueuedObjects();
+    for (Mesh* mesh : m_meshSlots) {
+        if (!mesh) continue;
+        mesh->PrepareContext();
+        if (m_geometryArena) m_geometryArena->Add(*mesh);
+    }
 
-    shadowMap->UpdateLightSpaceMatrix(lightPos, lightTarget);
-    glm::mat4 lightSpaceMatrix = shadowMap->GetLightSpaceMatrix();
+    SystemFrameContext context;
+    context.deltaTime = snapshot.deltaTime;
+    context.frameIndex = snapshot.frameIndex;
+    m_frameGraph->Execute(engine->GetThreadPool(), context);
 
-    shadowMap->BeginShadowPass();
-    depthShader->Bind();
-    depthShader->SetMat4("lightSpaceMatrix", lightSpaceMatrix);
+    Telemetry::CountCulling(m_cameraCullStats.visible, m_cameraCullStats.GetCulled(),
+        m_shadowCullStats.visible, m_shadowCullStats.GetCulled());
+    Telemetry::CountOcclusion(m_occlusion.GetStats().occluded, m_occlusion.GetStats().occluders);
 
-    if (m_window) {
-        Engine* engine = m_window->GetEngine();
-        if (engine) {
-            ScriptSystem* scripts = engine->GetScriptSystem();
-            if (scripts) {
-                for (int id = 0; id < 10; id++) {
-                    auto* script = scripts->GetScript(id);
-                    if (!script || !script->IsLoaded()) continue;
-
-                    sol::table obj = script->GetScriptTable();
-
-                    if (obj["isCamera"].valid() && obj["isCamera"].get<bool>()) {
-                        continue;
-                    }
-
-                    if (!obj["position"].valid()) continue;
-
-                    glm::vec3 pos = obj["position"].get<glm::vec3>();
-                    glm::vec3 rotation = obj["rotation"].valid() ?
-                        obj["rotation"].get<glm::vec3>() : glm::vec3(0.0f);
-
-                    glm::mat4 model = glm::mat4(1.0f);
-                    model = glm::translate(model, pos);
-                    model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0, 1, 0));
-                    model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1, 0, 0));
-                    model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0, 0, 1));
-
-                    if (obj["size"].valid()) {
-                        glm::vec3 size = obj["size"].get<glm::vec3>();
-                        model = glm::scale(model, size);
-
-                        depthShader->SetMat4("model", model);
-                        m_meshCache.Get("cube")->Draw();
-                    }
-                    else if (obj["radius"].valid()) {
-                        float radius = obj["radius"].get<float>();
-                        model = glm::scale(model, glm::vec3(radius));
-
-                        depthShader->SetMat4("model", model);
-
-                        auto* sphere = m_meshCache.GetOrCreate("sphere", []() {
-                            StaticMeshes::SphereParams params;
-                            params.latitudeSegments = 16;
-                            params.longitudeSegments = 16;
-                            return StaticMeshes::GetSphere(params);
-                            });
-                        sphere->Draw();
-                    }
-                }
+    m_backend->EndFrame();
+    m_frame.snapshot = nullptr;
+}
+
+void Renderer::BuildFrameGraph() {
+    m_frameGraph = std::make_unique<SystemGraph>("Render" + std::to_string(m_window->GetID()));
+
+    m_frameGraph->AddSystem("ShadowPrep", [this](const SystemFrameContext&) {
+        UpdateShadowCascades();
+        })
+        .Writes("LightSpace");
+
+    m_frameGraph->AddSystem("CullingBounds", [this](const SystemFrameContext&) {
+        BuildCullingBounds();
+        })
+        .Reads("Snapshot")
+        .Writes("CullingBounds");
+
+    m_frameGraph->AddSystem("MeshLods", [this](const SystemFrameContext&) {
+        SelectMeshLods();
+        })
+        .Reads("Snapshot")
+        .Reads("CullingBounds")
+        .Writes("MeshLods");
+
+    m_frameGraph->AddSystem("CameraCulling", [this](const SystemFrameContext&) {
+        CullCamera();
+        })
+        .Reads("CullingBounds")
+        .Writes("VisibleObjects");
+
+    m_frameGraph->AddSystem("OcclusionCulling", [this](const SystemFrameContext&) {
+        CullOcclusion();
+        })
+        .Reads("Snapshot")
+        .Reads("CullingBounds")
+        .Writes("VisibleObjects");
+
+    m_frameGraph->AddSystem("ShadowCulling", [this](const SystemFrameContext&) {
+        CullShadowCasters();
+        })
+        .Reads("CullingBounds")
+        .Reads("LightSpace")
+        .Reads("MeshLods")
+        .Writes("ShadowCasters");
+
+    m_frameGraph->AddSystem("ShadowDrawList", [this](const SystemFrameContext&) {
+        BuildShadowDrawList();
+        })
+        .Reads("Snapshot")
+        .Reads("ShadowCasters")
+        .Reads("MeshLods")
+        .Writes("ShadowDrawList");
+
+    m_frameGraph->AddSystem("SceneDrawList", [this](const SystemFrameContext&) {
+        BuildSceneDrawList();
+        })
+        .Reads("Snapshot")
+        .Reads("VisibleObjects")
+        .Reads("MeshLods")
+        .Writes("SceneDrawList");
+
+    m_frameGraph->AddSystem("InstanceBuild", [this](const SystemFrameContext&) {
+        BuildInstances();
+        })
+        .Reads("Snapshot")
+        .Reads("ShadowDrawList")
+        .Reads("SceneDrawList")
+        .Writes("Instances");
+
+    // One recording system per shadow layer plus the scene, they only read
+    // the batches and each writes its own indirect slots and command buffer
+    for (uint32_t i = 0; i < MAX_SHADOW_CASCADES; ++i) {
+        m_frameGraph->AddSystem("ShadowRecord" + std::to_string(i), [this, i](const SystemFrameContext&) {
+            RecordShadowLayer(i);
+            })
+            .Reads("Instances")
+            .Writes("ShadowCommands" + std::to_string(i));
+    }
+
+    m_frameGraph->AddSystem("SceneRecord", [this](const SystemFrameContext&) {
+        RecordScene();
+        })
+        .Reads("Instances")
+        .Writes("SceneCommands");
+
+    m_frameGraph->AddSystem("LightClusters", [this](const SystemFrameContext&) {
+        BuildLightClusters();
+        })
+        .Writes("LightClusters");
+
+    SystemGraph::SystemBuilder submit = m_frameGraph->AddSystem("Submit", [this](const SystemFrameContext&) {
+        SubmitFrame();
+        });
+    submit.Reads("LightSpace")
+        .Reads("LightClusters")
+        .Reads("Instances")
+        .Reads("SceneCommands")
+        .Writes("Backbuffer")
+        .Affinity(SystemAffinity::CallingThread);
+    for (uint32_t i = 0; i < MAX_SHADOW_CASCADES; ++i) {
+        submit.Reads("ShadowCommands" + std::to_string(i));
+    }
+
+    m_frameGraph->AddSystem("UI", [this](const SystemFrameContext&) {
+        RenderFrameUI();
+        })
+        .Writes("Backbuffer")
+        .Affinity(SystemAffinity::CallingThread);
+}
+
+void Renderer::BuildCullingBounds() {
+    const std::vector<RenderObjectSnapshot>& objects = m_frame.snapshot->objects;
+    m_cullBounds.Resize(objects.size());
+
+    auto build = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            const RenderObjectSnapshot& object = objects[i];
+            const Mesh* mesh = m_meshSlots[GetMeshSlot(object.shape, 0)];
+            if (!mesh) {
+                m_cullBounds.Set(i, object.position, object.boundingRadius);
+                continue;
             }
+
+            // Mesh sphere moved into world space, radius grown by the largest axis scale
+            const Mesh::Bounds& local = mesh->GetBounds();
+            glm::vec3 center = glm::vec3(object.model * glm::vec4(local.center, 1.0f));
+            float scale = std::max({ glm::length(glm::vec3(object.model[0])),
+                glm::length(glm::vec3(object.model[1])),
+                glm::length(glm::vec3(object.model[2])) });
+            m_cullBounds.Set(i, center, local.radius * scale);
         }
+        };
+
+    Engine* engine = m_window->GetEngine();
+    ThreadPool* pool = engine ? engine->GetThreadPool() : nullptr;
+    if (pool) {
+        pool->ParallelForRange(0, objects.size(), pool->SuggestGrainSize(objects.size(), 256), build);
+    }
+    else {
+        build(0, objects.size());
     }
+}
 
-    shadowMap->EndShadowPass();
+void Renderer::SelectMeshLods() {
+    if (!m_settings.meshLods) {
+        m_lodSelector.Reset();
+        return;
+    }
 
-    // === PASS 2: NORMAL RENDER WITH SHADOWS ===
-    m_backend->SetViewport(0, 0, width, height);
-    m_backend->BeginFrame();
-    m_backend->Clear(glm::vec4(m_settings.backgroundColor, 1.0f));
+    Engine* engine = m_window->GetEngine();
 
-    pbrShader->Bind();
-    pbrShader->SetMat4("view", view);
-    pbrShader->SetMat4("projection", projection);
-    pbrShader->SetMat4("lightSpaceMatrix", lightSpaceMatrix);
-    pbrShader->SetVec3("viewPos", cameraPos);
-    pbrShader->SetVec3("lightPos", lightPos);
+    LodSelectParams params;
+    params.cameraPos = m_frame.cameraPos;
+    params.projectionScale = static_cast<float>(m_frame.height) / (2.0f * std::tan(m_frame.fovY * 0.5f));
+    params.nearPlane = m_frame.nearPlane;
+    params.thresholdPixels = std::max(m_settings.lodErrorPixels, 0.01f);
 
-    shadowMap->BindForReading(1);
+    m_lodSelector.Select(m_frame.snapshot->objects, m_cullBounds, m_shapeLods, params,
+        engine ? engine->GetThreadPool() : nullptr);
+}
 
-    pbrShader->SetInt("shadowMap", 1);
-    pbrShader->SetBool("useAlbedoMap", false);
-    pbrShader->SetBool("useNormalMap", false);
-    pbrShader->SetBool("useMetallicMap", false);
-    pbrShader->SetBool("useRoughnessMap", false);
-    pbrShader->SetBool("useAOMap", false);
+const std::vector<uint8_t>* Renderer::GetMeshLods() const {
+    // Empty while LODs are off, every object then draws level 0
+    const std::vector<uint8_t>& levels = m_lodSelector.GetLevels();
+    return !levels.empty() && levels.size() == m_frame.snapshot->objects.size() ? &levels : nullptr;
+}
 
-    if (m_window) {
-        Engine* engine = m_window->GetEngine();
-        if (engine) {
-            ScriptSystem* scripts = engine->GetScriptSystem();
-
-            if (scripts) {
-                for (int id = 0; id < 10; id++) {
-                    auto* script = scripts->GetScript(id);
-                    if (!script || !script->IsLoaded()) continue;
-
-                    sol::table obj = script->GetScriptTable();
-
-                    if (obj["isCamera"].valid() && obj["isCamera"].get<bool>()) {
-                        continue;
-                    }
-
-                    if (!obj["position"].valid()) continue;
-
-                    glm::vec3 pos = obj["position"].get<glm::vec3>();
-                    glm::vec3 color = obj["color"].valid() ?
-                        obj["color"].get<glm::vec3>() : glm::vec3(1.0f);
-
-                    pbrShader->SetVec3("color", color);
-                    pbrShader->SetVec3("albedo", glm::vec3(1.0f));
-                    pbrShader->SetFloat("metallic", obj["metallic"].valid() ?
-                        obj["metallic"].get<float>() : 0.0f);
-                    pbrShader->SetFloat("roughness", obj["roughness"].valid() ?
-                        obj["roughness"].get<float>() : 0.5f);
-                    pbrShader->SetFloat("ao", 1.0f);
-
-                    glm::vec3 rotation = obj["rotation"].valid() ?
-                        obj["rotation"].get<glm::vec3>() : glm::vec3(0.0f);
-
-                    if (obj["size"].valid()) {
-                        glm::vec3 size = obj["size"].get<glm::vec3>();
-
-                        glm::mat4 model = glm::mat4(1.0f);
-                        model = glm::translate(model, pos);
-                        model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0, 1, 0));
-                        model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1, 0, 0));
-                        model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0, 0, 1));
-                        model = glm::scale(model, size);
-
-                        pbrShader->SetMat4("model", model);
-                        m_meshCache.Get("cube")->Draw();
-                    }
-                    else if (obj["radius"].valid()) {
-                        float radius = obj["radius"].get<float>();
-
-                        glm::mat4 model = glm::mat4(1.0f);
-                        model = glm::translate(model, pos);
-                        model = glm::scale(model, glm::vec3(radius));
-
-                        pbrShader->SetMat4("model", model);
-
-                        auto* sphere = m_meshCache.GetOrCreate("sphere", []() {
-                            StaticMeshes::SphereParams params;
-                            params.latitudeSegments = 16;
-                            params.longitudeSegments = 16;
-                            return StaticMeshes::GetSphere(params);
-                            });
-                        sphere->Draw();
-                    }
-                }
-            }
+void Renderer::UpdateShadowCascades() {
+    if (!m_settings.cascadedShadows) {
+        // Single fixed light volume around the scene origin
+        shadowMap->UpdateLightSpaceMatrix(m_frame.lightPos, m_frame.lightTarget);
+        m_cascades.SetFixed(shadowMap->GetLightSpaceMatrix(), m_frame.lightPos, 100.0f, m_frame.farPlane);
+        return;
+    }
+
+    ShadowCascadeSettings settings;
+    settings.cascadeCount = static_cast<uint32_t>(glm::clamp(m_settings.shadowCascades, 1, static_cast<int>(MAX_SHADOW_CASCADES)));
+    settings.splitLambda = m_settings.shadowSplitLambda;
+    settings.maxDistance = m_settings.shadowDistance;
+    settings.resolution = static_cast<uint32_t>(shadowMap->GetWidth());
+
+    m_cascades.Update(settings, m_frame.view, m_frame.fovY, m_frame.aspect,
+        m_frame.nearPlane, m_frame.farPlane, m_frame.lightDirection);
+}
+
+void Renderer::CullCamera() {
+    Engine* engine = m_window->GetEngine();
+    Math::Frustum frustum = Math::Frustum::FromMatrix(m_frame.projection * m_frame.view);
+
+    m_visibleObjects.clear();
+    m_cameraCullStats = m_cameraCuller.Cull(frustum, m_cullBounds, m_visibleObjects,
+        engine ? engine->GetThreadPool() : nullptr);
+}
+
+void Renderer::CullOcclusion() {
+    Engine* engine = m_window->GetEngine();
+    ThreadPool* pool = engine ? engine->GetThreadPool() : nullptr;
+
+    m_occlusion.Begin(m_frame.projection * m_frame.view, m_frame.nearPlane);
+    if (!m_settings.occlusionCulling || m_settings.occluderBudget <= 0) return;
+
+    // Boxes that cover the most screen make the best occluders, scored by
+    // radius over distance along the view direction. Only cubes qualify:
+    // spheres fill too little of their bounds, and WallSystem walls are never
+    // drawn by the renderer, so interiors are built from cube objects.
+    const std::vector<RenderObjectSnapshot>& objects = m_frame.snapshot->objects;
+    m_occluderCandidates.clear();
+    for (uint32_t index : m_visibleObjects) {
+        const RenderObjectSnapshot& object = objects[index];
+        if (object.shape != RenderShape::Cube) continue;
+
+        float depth = glm::dot(object.position - m_frame.cameraPos, m_frame.cameraForward);
+        float score = m_cullBounds.radius[index] / std::max(depth, m_frame.nearPlane);
+        if (score < 0.05f) continue;
+
+        m_occluderCandidates.emplace_back(score, index);
+    }
+
+    if (m_occluderCandidates.empty()) return;
+
+    size_t budget = std::min(m_occluderCandidates.size(), static_cast<size_t>(m_settings.occluderBudget));
+    std::partial_sort(m_occluderCandidates.begin(), m_occluderCandidates.begin() + budget, m_occluderCandidates.end(),
+        [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    for (size_t i = 0; i < budget; ++i) {
+        m_occlusion.AddBoxOccluder(objects[m_occluderCandidates[i].second].model);
+    }
+
+    m_occlusion.Rasterize(pool);
+    m_occlusion.Cull(m_cullBounds, m_visibleObjects, pool);
+}
+
+void Renderer::CullShadowCasters() {
+    Engine* engine = m_window->GetEngine();
+    ThreadPool* pool = engine ? engine->GetThreadPool() : nullptr;
+
+    const std::vector<RenderObjectSnapshot>& objects = m_frame.snapshot->objects;
+    bool caching = m_settings.shadowCaching;
+    if (caching) m_shadowCache.BeginFrame(m_cascades.GetCount());
+    else m_shadowCache.Invalidate();
+
+    // Each cascade only keeps the casters inside its own light volume, the
+    // stats add up the tests of every cascade
+    m_shadowCullStats = {};
+    for (uint32_t i = 0; i < MAX_SHADOW_CASCADES; ++i) {
+        ShadowLayerPass& pass = m_shadowPasses[i];
+        pass.casters.clear();
+        pass.staticCasters.clear();
+        pass.rebuildStatic = false;
+        if (i >= m_cascades.GetCount()) continue;
+
+        const ShadowCascade& cascade = m_cascades.GetCascade(i);
+        Math::Frustum frustum = Math::Frustum::FromMatrix(cascade.viewProjection);
+        CullingStats stats = m_shadowCuller.Cull(frustum, m_cullBounds, pass.casters, pool);
+        m_shadowCullStats.tested += stats.tested;
+        m_shadowCullStats.visible += stats.visible;
+
+        if (!caching) continue;
+
+        // Static casters leave the per frame list, they are only drawn again
+        // when the cached depth of this layer goes stale
+        uint64_t staticHash = ShadowCache::HashStaticCasters(objects, pass.casters, GetMeshLods());
+        pass.rebuildStatic = m_shadowCache.Validate(i, cascade.viewProjection, staticHash);
+
+        size_t dynamicCount = 0;
+        for (uint32_t index : pass.casters) {
+            if (!objects[index].isStatic) pass.casters[dynamicCount++] = index;
+            else if (pass.rebuildStatic) pass.staticCasters.push_back(index);
         }
+        pass.casters.resize(dynamicCount);
     }
+}
 
-    UIX* ui = m_window->GetUI();
-    if (ui && ui->IsInitialized()) {
-        m_window->BeginImGuiFrame();
-
-        if (m_settings.showDebugInfo) {
-            ImGui::Begin("FPS Debug", &m_settings.showDebugInfo);
-            ImGui::Text("FPS: %.1f", ImGui::GetIO().Framerate);
-            ImGui::Text("Frame Time: %.3f ms", 1000.0f / ImGui::GetIO().Framerate);
-            ImGui::Separator();
-            ImGui::Text("Camera Position: (%.1f, %.1f, %.1f)",
-                cameraPos.x, cameraPos.y, cameraPos.z);
-            ImGui::Text("Camera Rotation: (%.1f, %.1f, %.1f)",
-                cameraRot.x, cameraRot.y, cameraRot.z);
-            ImGui::Separator();
-            ImGui::Text("Light Position: (%.1f, %.1f, %.1f)",
-                lightPos.x, lightPos.y, lightPos.z);
-            ImGui::Separator();
-            ImGui::Text("Controls:");
-            ImGui::Text("WASD - Move");
-            ImGui::Text("Mouse - Look");
-            ImGui::Text("Space - Jump");
-            ImGui::End();
+void Renderer::BuildShadowDrawList() {
+    Engine* engine = m_window->GetEngine();
+
+    // Depth runs along the light direction from the eye of each cascade
+    DrawListParams params;
+    params.pass = DrawPass::Shadow;
+    params.shaderID = static_cast<uint32_t>(m_frame.depthShader->GetID());
+    params.forward = m_frame.lightDirection;
+    params.nearPlane = 0.0f;
+    params.meshLods = GetMeshLods();
+
+    for (uint32_t i = 0; i < m_cascades.GetCount(); ++i) {
+        const ShadowCascade& cascade = m_cascades.GetCascade(i);
+        params.origin = cascade.lightOrigin;
+        params.farPlane = cascade.depthRange;
+
+        ShadowLayerPass& pass = m_shadowPasses[i];
+        pass.drawList.Build(m_frame.snapshot->objects, &pass.casters, params,
+            engine ? engine->GetThreadPool() : nullptr);
+        pass.drawList.Sort();
+
+        if (pass.rebuildStatic) {
+            pass.staticDrawList.Build(m_frame.snapshot->objects, &pass.staticCasters, params,
+                engine ? engine->GetThreadPool() : nullptr);
+            pass.staticDrawList.Sort();
         }
+    }
+}
 
-        m_window->EndImGuiFrame();
+void Renderer::BuildSceneDrawList() {
+    Engine* engine = m_window->GetEngine();
+
+    DrawListParams params;
+    params.pass = DrawPass::Opaque;
+    params.shaderID = static_cast<uint32_t>(m_frame.pbrShader->GetID());
+    params.origin = m_frame.cameraPos;
+    params.forward = m_frame.cameraForward;
+    params.nearPlane = m_frame.nearPlane;
+    params.farPlane = m_frame.farPlane;
+    params.meshLods = GetMeshLods();
+
+    m_sceneDrawList.Build(m_frame.snapshot->objects, &m_visibleObjects, params,
+        engine ? engine->GetThreadPool() : nullptr);
+    m_sceneDrawList.Sort();
+}
+
+void Renderer::BuildInstances() {
+    Engine* engine = m_window->GetEngine();
+    ThreadPool* pool = engine ? engine->GetThreadPool() : nullptr;
+
+    m_recordIndirect = m_geometryArena && m_settings.multiDrawIndirect;
+    uint32_t cascadeCount = m_cascades.GetCount();
+
+    // Every pass appends to the one instance array, so batching stays in
+    // pass order. Recording the commands is split out per layer below.
+    m_instances.Clear();
+    for (uint32_t i = 0; i < MAX_SHADOW_CASCADES; ++i) {
+        ShadowLayerPass& pass = m_shadowPasses[i];
+        pass.batches = {};
+        pass.staticBatches = {};
+        if (i >= cascadeCount) continue;
+
+        if (pass.rebuildStatic) {
+            pass.staticBatches = m_instances.AddPass(m_frame.snapshot->objects, pass.staticDrawList, m_meshSlots, pool);
+        }
+        pass.batches = m_instances.AddPass(m_frame.snapshot->objects, pass.drawList, m_meshSlots, pool);
     }
+    m_sceneBatches = m_instances.AddPass(m_frame.snapshot->objects, m_sceneDrawList, m_meshSlots, pool);
 
-    m_backend->EndFrame();
+    if (m_recordIndirect) m_instances.ReserveIndirectCommands();
+}
+
+void Renderer::RecordShadowLayer(uint32_t layer) {
+    ShadowLayerPass& pass = m_shadowPasses[layer];
+    pass.commands.Reset();
+    pass.staticCommands.Reset();
+    if (layer >= m_cascades.GetCount()) return;
+
+    if (m_recordIndirect) {
+        m_instances.RecordIndirectDraws(pass.staticBatches, *m_geometryArena, pass.staticCommands);
+        m_instances.RecordIndirectDraws(pass.batches, *m_geometryArena, pass.commands);
+    }
+    else {
+        m_instances.RecordDraws(pass.staticBatches, pass.staticCommands);
+        m_instances.RecordDraws(pass.batches, pass.commands);
+    }
+}
+
+void Renderer::RecordScene() {
+    m_sceneCommands.Reset();
+    if (m_recordIndirect) m_instances.RecordIndirectDraws(m_sceneBatches, *m_geometryArena, m_sceneCommands);
+    else m_instances.RecordDraws(m_sceneBatches, m_sceneCommands);
+}
+
+bool Renderer::UploadInstances() {
+    m_replay = CommandReplayContext{};
+    if (m_instances.GetInstanceCount() == 0) return true;
+
+    // Instance aligned, so the offset is a whole number of instances and the
+    // mesh attribute bindings can stay at offset 0
+    size_t bytes = m_instances.GetSizeBytes();
+    StreamAllocation allocation = m_instanceStream->Allocate(bytes, sizeof(InstanceData));
+    if (!allocation.IsValid()) return false;
+
+    std::memcpy(allocation.data, m_instances.GetInstances().data(), bytes);
+    m_replay.instanceOffset = static_cast<unsigned int>(allocation.offset / sizeof(InstanceData));
+
+    // Indirect commands were recorded against instance 0, rebased here now
+    // that the instance offset is known
+    const std::vector<IndirectDrawCommand>& indirect = m_instances.GetIndirectCommands();
+    if (!indirect.empty()) {
+        StreamAllocation commands = m_instanceStream->Allocate(indirect.size() * sizeof(IndirectDrawCommand), sizeof(uint32_t));
+        if (!commands.IsValid()) return false;
+
+        IndirectDrawCommand* out = static_cast<IndirectDrawCommand*>(commands.data);
+        for (size_t i = 0; i < indirect.size(); ++i) {
+            out[i] = indirect[i];
+            out[i].baseInstance += m_replay.instanceOffset;
+        }
+
+        m_replay.indirectBuffer = m_instanceStream->GetBuffer();
+        m_replay.indirectOffset = commands.offset;
+    }
+
+    m_instanceStream->Flush();
+
+    unsigned int buffer = m_instanceStream->GetBuffer();
+    for (Mesh* mesh : m_meshSlots) {
+        if (mesh) mesh->AttachInstanceBuffer(buffer);
+    }
+    if (m_geometryArena) m_geometryArena->AttachInstanceBuffer(buffer);
+    return true;
+}
+
+void Renderer::CreateUniformBuffers() {
+    m_frameUniforms.Create(m_backend, UniformBinding::Frame, sizeof(FrameBlock));
+    m_cameraUniforms.Create(m_backend, UniformBinding::Camera, sizeof(CameraBlock));
+    m_lightUniforms.Create(m_backend, UniformBinding::Lights, sizeof(LightBlock));
+    m_materialUniforms.Create(m_backend, UniformBinding::Material, sizeof(MaterialBlock));
+
+    // Per object color and material come from the instance attributes, the
+    // material block only changes once textured materials exist
+    m_materialUniforms.Update(MaterialBlock{});
+
+    // Never change after this, each shadow pass binds the one of its layer
+    for (uint32_t i = 0; i < MAX_SHADOW_CASCADES; ++i) {
+        ShadowLayerBlock block;
+        block.layer.x = static_cast<int>(i);
+        m_shadowLayerUniforms[i].Create(m_backend, UniformBinding::ShadowLayer, sizeof(ShadowLayerBlock));
+        m_shadowLayerUniforms[i].Update(block);
+    }
 }
 
-void Renderer::RenderSceneObjects(Shader* shader, const glm::mat4& view,
-    const glm::mat4& projection) {
-    if (!m_window) return;
+void Renderer::CreateLightClusterBuffers() {
+    m_clusterUniforms.Create(m_backend, UniformBinding::Clusters, sizeof(ClusterBlock));
+
+    m_clusterLightBuffer = std::make_unique<TextureBuffer>(GL_RGBA32F);
+    m_clusterRangeBuffer = std::make_unique<TextureBuffer>(GL_RG32UI);
+    m_clusterIndexBuffer = std::make_unique<TextureBuffer>(GL_R32UI);
+
+    if (!m_clusterLightBuffer->Initialize(256 * sizeof(GpuLight)) ||
+        !m_clusterRangeBuffer->Initialize(m_lightClusters.GetClusterCount() * sizeof(glm::uvec2)) ||
+        !m_clusterIndexBuffer->Initialize(m_lightClusters.GetClusterCount() * 8 * sizeof(uint32_t))) {
+        throw std::runtime_error("Failed to initialize light cluster buffers");
+    }
+}
 
+void Renderer::BuildLightClusters() {
     Engine* engine = m_window->GetEngine();
-    if (!engine) return;
+    m_lightClusters.Build(m_clusterLights, m_frame.view, m_frame.fovY, m_frame.aspect,
+        m_frame.nearPlane, m_frame.farPlane, engine ? engine->GetThreadPool() : nullptr);
+}
+
+void Renderer::UploadLightClusters() {
+    ClusterBlock clusters;
+    m_lightClusters.FillUniformBlock(clusters, m_frame.width, m_frame.height);
+    m_clusterUniforms.Update(clusters);
+    m_clusterUniforms.Bind();
+
+    // GpuLight is four vec4 texels in the light buffer
+    m_clusterLightBuffer->Upload(m_clusterLights);
+    m_clusterRangeBuffer->Upload(m_lightClusters.GetRanges());
+    m_clusterIndexBuffer->Upload(m_lightClusters.GetIndices());
+}
+
+void Renderer::UploadUniforms() {
+    FrameBlock frame;
+    for (uint32_t i = 0; i < m_cascades.GetCount(); ++i) {
+        const ShadowCascade& cascade = m_cascades.GetCascade(i);
+        frame.cascadeMatrices[i] = cascade.viewProjection;
+        frame.cascadeSplits[i] = cascade.splitFar;
+    }
+    frame.shadowInfo.x = static_cast<int>(m_cascades.GetCount());
+    frame.time = glm::vec4(m_frame.time, m_frame.deltaTime, static_cast<float>(m_frame.frameIndex), 0.0f);
+    m_frameUniforms.Update(frame);
+
+    CameraBlock camera;
+    camera.view = m_frame.view;
+    camera.projection = m_frame.projection;
+    camera.viewProjection = m_frame.projection * m_frame.view;
+    camera.position = glm::vec4(m_frame.cameraPos, 1.0f);
+    m_cameraUniforms.Update(camera);
+
+    LightBlock lights;
+    m_lightingSystem->FillUniformBlock(lights, m_settings.clusteredLighting);
+    m_lightUniforms.Update(lights);
+
+    m_frameUniforms.Bind();
+    m_cameraUniforms.Bind();
+    m_lightUniforms.Bind();
+    m_materialUniforms.Bind();
+}
 
-    ScriptSystem* scripts = engine->GetScriptSystem();
-    if (!scripts) return;
+void Renderer::BuildRenderGraph(bool instancesReady) {
+    m_renderGraph.Reset();
 
-    for (int id = 0; id < 10; id++) {
-        auto* script = scripts->GetScript(id);
-        if (!script || !script->IsLoaded()) continue;
+    // One layer of the shadow map per cascade, the depth shader picks the
+    // matching matrix from the frame block
+    shadowMap->SetLayerCount(m_cascades.GetCount());
+    shadowMap->SetStaticCacheEnabled(m_settings.shadowCaching);
 
-        sol::table obj = script->GetScriptTable();
+    RenderResource backbuffer = m_renderGraph.ImportBackbuffer(m_frame.width, m_frame.height);
+    RenderResource shadowDepth = m_renderGraph.CreateTexture("ShadowDepth", shadowMap->GetDesc());
+    RenderResource staticDepth = INVALID_RENDER_RESOURCE;
+    if (shadowMap->IsStaticCacheEnabled()) {
+        staticDepth = m_renderGraph.ImportTexture("StaticShadowDepth", shadowMap->GetDesc(), shadowMap->GetStaticDepthMap());
+    }
 
-        if (obj["isCamera"].valid() && obj["isCamera"].get<bool>()) {
-            continue;
+    uint32_t layersRebuilt = 0;
+    uint32_t layersCached = 0;
+    for (uint32_t i = 0; i < m_cascades.GetCount(); ++i) {
+        if (staticDepth != INVALID_RENDER_RESOURCE) {
+            if (m_shadowPasses[i].rebuildStatic) {
+                m_renderGraph.AddPass("StaticShadow" + std::to_string(i), [this, i, instancesReady](RenderPassContext&) {
+                    m_frame.depthShader->Bind();
+                    m_shadowLayerUniforms[i].Bind();
+                    if (instancesReady) m_shadowPasses[i].staticCommands.Execute(*m_backend, m_replay);
+                }).Writes(staticDepth, LoadOp::Clear, i);
+                ++layersRebuilt;
+            }
+            else {
+                ++layersCached;
+            }
         }
 
-        if (!obj["position"].valid()) continue;
-
-        glm::vec3 pos = obj["position"].get<glm::vec3>();
-        glm::vec3 color = obj["color"].valid() ?
-            obj["color"].get<glm::vec3>() : glm::vec3(1.0f);
-        glm::vec3 rotation = obj["rotation"].valid() ?
-            obj["rotation"].get<glm::vec3>() : glm::vec3(0.0f);
-
-        // Set material properties if using PBR shader
-		//if (shader->GetID() == 1) { 
-  //          shader->SetMat4("view", view);
-  //          shader->SetMat4("projection", projection);
-		//}
-        if (shader->GetID() == 1) {
-            shader->SetVec3("albedo", color);
-            shader->SetFloat("metallic", obj["metallic"].valid() ?
-                obj["metallic"].get<float>() : 0.0f);
-            shader->SetFloat("roughness", obj["roughness"].valid() ?
-                obj["roughness"].get<float>() : 0.5f);
-            shader->SetFloat("ao", 1.0f);
+        // Starts from the cached static depth when the cache is on, the
+        // copy covers the whole layer
+        auto shadowPass = m_renderGraph.AddPass("Shadow" + std::to_string(i),
+            [this, i, instancesReady, shadowDepth, staticDepth](RenderPassContext& context) {
+                if (staticDepth != INVALID_RENDER_RESOURCE) {
+                    shadowMap->CopyStaticLayer(context.GetTexture(shadowDepth), i);
+                }
+                m_frame.depthShader->Bind();
+                m_shadowLayerUniforms[i].Bind();
+                if (instancesReady) m_shadowPasses[i].commands.Execute(*m_backend, m_replay);
+            });
+        if (staticDepth != INVALID_RENDER_RESOURCE) {
+            shadowPass.Reads(staticDepth).Writes(shadowDepth, LoadOp::DontCare, i);
+        }
+        else {
+            shadowPass.Writes(shadowDepth, LoadOp::Clear, i);
         }
+    }
+
+    // Layers marked valid this frame never got their static casters
+    if (!instancesReady) m_shadowCache.Invalidate();
+    Telemetry::CountShadowCache(layersRebuilt, layersCached);
+
+    // Everything but the instance attributes comes from the uniform blocks,
+    // samplers are bound to fixed units in the shaders
+    m_renderGraph.AddPass("Scene", [this, instancesReady, shadowDepth](RenderPassContext& context) {
+        m_frame.pbrShader->Bind();
+        context.BindTexture(shadowDepth, TextureUnit::ShadowMap);
+        m_clusterLightBuffer->Bind(TextureUnit::ClusterLights);
+        m_clusterRangeBuffer->Bind(TextureUnit::ClusterRanges);
+        m_clusterIndexBuffer->Bind(TextureUnit::ClusterIndices);
+
+        if (instancesReady) m_sceneCommands.Execute(*m_backend, m_replay);
+    }).Reads(shadowDepth).Writes(backbuffer, LoadOp::Clear).ClearColor(glm::vec4(m_settings.backgroundColor, 1.0f));
+}
 
-        glm::mat4 model = glm::mat4(1.0f);
-        model = glm::translate(model, pos);
-        model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0, 1, 0));
-        model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1, 0, 0));
-        model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0, 0, 1));
-
-        if (obj["size"].valid()) {
-            glm::vec3 size = obj["size"].get<glm::vec3>();
-            model = glm::scale(model, size);
-            shader->SetMat4("model", model);
-            m_meshCache.Get("cube")->Draw();
+void Renderer::SubmitFrame() {
+    // Growing has to happen between frames, the slack covers the alignment
+    m_instanceStream->Reserve(m_instances.GetSizeBytes() + sizeof(InstanceData) +
+        m_instances.GetIndirectCommands().size() * sizeof(IndirectDrawCommand) + sizeof(uint32_t));
+    m_instanceStream->BeginFrame();
+
+    bool instancesReady = UploadInstances();
+    UploadUniforms();
+    UploadLightClusters();
+
+    m_backend->BeginFrame();
+
+    BuildRenderGraph(instancesReady);
+    m_renderGraph.Compile();
+    m_renderGraph.Execute(m_renderTargets);
+
+    m_instanceStream->EndFrame();
+}
+
+void Renderer::RenderFrameUI() {
+    UIX* ui = m_window->GetUI();
+    if (!ui || !ui->IsInitialized()) return;
+
+    const glm::vec3& cameraPos = m_frame.cameraPos;
+    const glm::vec3& cameraRot = m_frame.cameraRot;
+    const glm::vec3& lightPos = m_frame.lightPos;
+
+    std::lock_guard<std::recursive_mutex> uiLock(UIX::GetSharedMutex());
+    m_window->BeginImGuiFrame();
+
+    if (m_settings.showDebugInfo) {
+        ImGui::Begin("FPS Debug", &m_settings.showDebugInfo);
+        ImGui::Text("FPS: %.1f", ImGui::GetIO().Framerate);
+        ImGui::Text("Frame Time: %.3f ms", 1000.0f / ImGui::GetIO().Framerate);
+        ImGui::Separator();
+        ImGui::Text("Camera Position: (%.1f, %.1f, %.1f)",
+            cameraPos.x, cameraPos.y, cameraPos.z);
+        ImGui::Text("Camera Rotation: (%.1f, %.1f, %.1f)",
+            cameraRot.x, cameraRot.y, cameraRot.z);
+        ImGui::Separator();
+        ImGui::Text("Light Position: (%.1f, %.1f, %.1f)",
+            lightPos.x, lightPos.y, lightPos.z);
+        ImGui::Text("Culling (%s): %u / %u visible, %u / %u shadow casters",
+            FrustumCuller::GetPathName(FrustumCuller::GetActivePath()),
+            m_cameraCullStats.visible, m_cameraCullStats.tested,
+            m_shadowCullStats.visible, m_shadowCullStats.tested);
+        if (m_settings.meshLods) {
+            const LodStats& lods = m_lodSelector.GetStats();
+            ImGui::Text("Mesh LODs: %u / %u / %u / %u objects, %u switches",
+                lods.objectsPerLevel[0], lods.objectsPerLevel[1], lods.objectsPerLevel[2], lods.objectsPerLevel[3],
+                lods.switches);
+            ImGui::Text("LOD Triangles: %llu of %llu at full detail",
+                static_cast<unsigned long long>(lods.selectedTriangles), static_cast<unsigned long long>(lods.fullTriangles));
+        }
+        if (m_settings.occlusionCulling) {
+            const OcclusionStats& occlusion = m_occlusion.GetStats();
+            ImGui::Text("Occlusion: %u occluders, %u triangles, %u / %u hidden",
+                occlusion.occluders, occlusion.triangles, occlusion.occluded, occlusion.tested);
+        }
+        uint32_t shadowBatchCount = 0;
+        for (const ShadowLayerPass& pass : m_shadowPasses) {
+            shadowBatchCount += pass.batches.batchCount + pass.staticBatches.batchCount;
+        }
+        ImGui::Text("Instanced Draws: %u shadow, %u scene",
+            shadowBatchCount, m_sceneBatches.batchCount);
+        for (uint32_t i = 0; i < m_cascades.GetCount(); ++i) {
+            const ShadowCascade& cascade = m_cascades.GetCascade(i);
+            const ShadowLayerPass& pass = m_shadowPasses[i];
+            ImGui::Text("Cascade %u: %.1f - %.1f, %zu casters%s",
+                i, cascade.splitNear, cascade.splitFar, pass.casters.size() + pass.staticCasters.size(),
+                pass.rebuildStatic ? ", static rebuilt" : "");
+        }
+        if (m_settings.clusteredLighting) {
+            const LightClusterStats& clusters = m_lightClusters.GetStats();
+            const glm::uvec3& size = m_lightClusters.GetSize();
+            ImGui::Text("Light Clusters: %ux%ux%u, %u lights, %u refs, max %u per cluster",
+                size.x, size.y, size.z, clusters.lightCount, clusters.indexCount, clusters.maxPerCluster);
+            if (clusters.overflows > 0) {
+                ImGui::Text("  %u clusters over the %u light cap", clusters.overflows, MAX_LIGHTS_PER_CLUSTER);
+            }
+        }
+        if (m_settings.shadowCaching) {
+            const ShadowCacheStats& cache = m_shadowCache.GetStats();
+            ImGui::Text("Shadow Cache: %llu hits, %llu rebuilds",
+                static_cast<unsigned long long>(cache.hits), static_cast<unsigned long long>(cache.rebuilds));
+            ImGui::Text("Invalidated: %llu light, %llu static, %llu forced",
+                static_cast<unsigned long long>(cache.lightInvalidations),
+                static_cast<unsigned long long>(cache.staticInvalidations),
+                static_cast<unsigned long long>(cache.forcedInvalidations));
+        }
+        if (m_instanceStream) {
+            ImGui::Text("Instance Stream: %zu / %zu KB, %llu stalls%s",
+                m_instanceStream->GetUsedBytes() / 1024, m_instanceStream->GetRegionSize() / 1024,
+                static_cast<unsigned long long>(m_instanceStream->GetStallCount()),
+                m_instanceStream->IsPersistent() ? "" : " (orphaning)");
+        }
+        if (m_geometryArena) {
+            ImGui::Text("Geometry Arena: %zu meshes, %u vertices, %u indices",
+                m_geometryArena->GetMeshCount(), m_geometryArena->GetUsedVertices(), m_geometryArena->GetUsedIndices());
+        }
+        {
+            const RenderGraphStats& graph = m_renderGraph.GetStats();
+            ImGui::Text("Render Graph: %u passes, %u culled, %u transitions",
+                graph.passes, graph.culledPasses, graph.transitions);
+            ImGui::Text("Transient Targets: %u in %u textures, %zu / %zu KB",
+                graph.transientTextures, graph.physicalTextures,
+                graph.physicalBytes / 1024, graph.transientBytes / 1024);
+
+            const SharedResourceStats shared = SharedResources::Get().GetStats();
+            ImGui::Text("Shared Resources: %u meshes (%zu KB), %u shaders, %u textures",
+                shared.meshes, shared.meshBytes / 1024, shared.shaders, shared.textures);
+            ImGui::Text("Shared Loads: %llu, %llu reused",
+                static_cast<unsigned long long>(shared.loads), static_cast<unsigned long long>(shared.hits));
+        }
+
+        if (ImGui::CollapsingHeader("Render Settings")) {
+            ImGui::Checkbox("Cascaded Shadows", &m_settings.cascadedShadows);
+            if (m_settings.cascadedShadows) {
+                ImGui::SliderInt("Cascades", &m_settings.shadowCascades, 1, static_cast<int>(MAX_SHADOW_CASCADES));
+                ImGui::SliderFloat("Split Lambda", &m_settings.shadowSplitLambda, 0.0f, 1.0f);
+                ImGui::SliderFloat("Shadow Distance", &m_settings.shadowDistance, 10.0f, 500.0f);
+            }
+            ImGui::Checkbox("Cache Static Shadows", &m_settings.shadowCaching);
+            ImGui::Checkbox("Clustered Lighting", &m_settings.clusteredLighting);
+            ImGui::Checkbox("Occlusion Culling", &m_settings.occlusionCulling);
+            if (m_settings.occlusionCulling) {
+                ImGui::SliderInt("Occluder Budget", &m_settings.occluderBudget, 1, 128);
+            }
+            ImGui::Checkbox("Mesh LODs", &m_settings.meshLods);
+            if (m_settings.meshLods) {
+                ImGui::SliderFloat("LOD Error (px)", &m_settings.lodErrorPixels, 0.25f, 8.0f);
+            }
+            if (m_geometryArena) {
+                ImGui::Checkbox("Multi-Draw Indirect", &m_settings.multiDrawIndirect);
+            }
+        }
+        ImGui::Separator();
+
+        Engine* engine = m_window->GetEngine();
+        const SystemGraph* graphs[] = { engine ? engine->GetUpdateGraph() : nullptr, m_frameGraph.get() };
+        for (const SystemGraph* graph : graphs) {
+            if (!graph) continue;
+
+            SystemGraphReport report = graph->GetLastReport();
+            if (ImGui::TreeNode(graph->GetName().c_str(), "%s: %.2f ms (critical path %.2f ms)",
+                graph->GetName().c_str(), report.wallMs, report.criticalPathMs)) {
+                for (const SystemTiming& timing : report.systems) {
+                    ImGui::Text("%s %-20s %.3f ms", timing.critical ? "*" : " ",
+                        timing.name.c_str(), timing.durationMs);
+                }
+                ImGui::TreePop();
+            }
         }
-        else if (obj["radius"].valid()) {
-            float radius = obj["radius"].get<float>();
-            model = glm::scale(model, glm::vec3(radius));
-            shader->SetMat4("model", model);
-
-            auto* sphere = m_meshCache.GetOrCreate("sphere", []() {
-                StaticMeshes::SphereParams params;
-                params.latitudeSegments = 32;
-                params.longitudeSegments = 32;
-                return StaticMeshes::GetSphere(params);
-                });
-            sphere->Draw();
+
+        if (engine) {
+            RenderTelemetryUI(engine->GetTelemetry());
+        }
+        ImGui::Separator();
+
+        ImGui::Text("Controls:");
+        ImGui::Text("WASD - Move");
+        ImGui::Text("Mouse - Look");
+        ImGui::Text("Space - Jump");
+        ImGui::End();
+    }
+
+    m_window->EndImGuiFrame();
+}
+
+void Renderer::RenderTelemetryUI(const FrameTelemetry& telemetry) {
+    if (!ImGui::CollapsingHeader("Telemetry")) return;
+
+    m_telemetryHistory.resize(FrameTelemetry::HISTORY_SIZE);
+    size_t count = telemetry.GetHistory(m_telemetryHistory.data(), m_telemetryHistory.size());
+    if (count == 0) {
+        ImGui::Text("No frames recorded yet");
+        return;
+    }
+
+    const FrameStats& latest = m_telemetryHistory[count - 1];
+    ImGui::Text("Frame %llu", static_cast<unsigned long long>(latest.frameIndex));
+    ImGui::Text("Draw Calls: %llu  Triangles: %llu",
+        static_cast<unsigned long long>(latest.drawCalls), static_cast<unsigned long long>(latest.triangles));
+    ImGui::Text("Uniform Uploads: %llu", static_cast<unsigned long long>(latest.uniformUploads));
+    ImGui::Text("Buffer Uploads: %llu (%.1f KB)",
+        static_cast<unsigned long long>(latest.bufferUploads), latest.bytesUploaded / 1024.0);
+    ImGui::Text("Shadow Layers: %u rebuilt, %u cached",
+        latest.shadowLayersRebuilt, latest.shadowLayersCached);
+    ImGui::Text("Occluded Objects: %u (%u occluders)", latest.occludedObjects, latest.occluders);
+    ImGui::Text("GL State Calls: %llu issued, %llu skipped",
+        static_cast<unsigned long long>(latest.stateCallsIssued), static_cast<unsigned long long>(latest.stateCallsSkipped));
+    ImGui::Text("Update: %.2f ms  Scripts: %.2f ms  Render: %.2f ms",
+        latest.updateMs, latest.scriptMs, latest.renderMs);
+
+    auto frameTime = [](void* data, int index) {
+        return static_cast<const FrameStats*>(data)[index].frameMs;
+        };
+    auto renderTime = [](void* data, int index) {
+        return static_cast<const FrameStats*>(data)[index].renderMs;
+        };
+    auto drawCalls = [](void* data, int index) {
+        return static_cast<float>(static_cast<const FrameStats*>(data)[index].drawCalls);
+        };
+
+    ImGui::PlotLines("Frame ms", frameTime, m_telemetryHistory.data(), static_cast<int>(count),
+        0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+    ImGui::PlotLines("Render ms", renderTime, m_telemetryHistory.data(), static_cast<int>(count),
+        0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+    ImGui::PlotLines("Draw calls", drawCalls, m_telemetryHistory.data(), static_cast<int>(count),
+        0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 40));
+}
+
+void Renderer::CreateShapeLods() {
+    // Latitude and longitude segments per level, spheres are re-tessellated
+    // rather than simplified so every level stays a true sphere grid
+    static constexpr std::array<std::pair<unsigned int, unsigned int>, MAX_MESH_LODS> SPHERE_LODS = { {
+        { 32, 32 }, { 16, 16 }, { 8, 8 }, { 4, 6 }
+    } };
+
+    for (MeshLodChain& chain : m_shapeLods) chain.Clear();
+    m_meshSlots = {};
+
+    // Meshes come from the shared registry, a second renderer only takes
+    // references. The renderer keeps them alive until Cleanup.
+    SharedResources& shared = SharedResources::Get();
+    m_sharedMeshes.clear();
+    auto acquire = [this, &shared](const std::string& key, const SharedResources::MeshFactory& factory) -> Mesh* {
+        std::shared_ptr<Mesh> mesh = shared.AcquireMesh(key, factory);
+        if (!mesh) return nullptr;
+        m_sharedMeshes.push_back(mesh);
+        return mesh.get();
+    };
+
+    // Twelve triangles, nothing to take away
+    m_shapeLods[static_cast<size_t>(RenderShape::Cube)].AddLevel(acquire("cube", []() {
+        return MeshFactory::CreateCube();
+        }), 0.0f);
+
+    MeshLodChain& sphere = m_shapeLods[static_cast<size_t>(RenderShape::Sphere)];
+    for (uint32_t level = 0; level < MAX_MESH_LODS; ++level) {
+        StaticMeshes::SphereParams params;
+        params.latitudeSegments = SPHERE_LODS[level].first;
+        params.longitudeSegments = SPHERE_LODS[level].second;
+
+        Mesh* mesh = acquire("sphere_lod" + std::to_string(level), [&params]() {
+            return StaticMeshes::GetSphere(params);
+            });
+        sphere.AddLevel(mesh, MeshSimplifier::GetSphereError(params.radius,
+            params.latitudeSegments, params.longitudeSegments));
+    }
+
+    for (size_t shape = 0; shape < RENDER_SHAPE_COUNT; ++shape) {
+        const MeshLodChain& chain = m_shapeLods[shape];
+        for (uint32_t level = 0; level < chain.GetCount(); ++level) {
+            m_meshSlots[GetMeshSlot(static_cast<RenderShape>(shape), level)] = chain.GetLevel(level).mesh;
         }
     }
 }
@@ -501,14 +1085,42 @@ void Renderer::Cleanup() {
         m_window->MakeContextCurrent();
     }
 
+    m_frameGraph.reset();
+    m_renderGraph.Reset();
+    m_renderTargets.Cleanup();
+    for (ShadowLayerPass& pass : m_shadowPasses) {
+        pass.commands.Reset();
+        pass.staticCommands.Reset();
+    }
+    m_sceneCommands.Reset();
+    m_instances.Clear();
+    m_meshSlots = {};
+    for (MeshLodChain& chain : m_shapeLods) chain.Clear();
+    m_lodSelector.Reset();
+
+    m_instanceStream.reset();
+    m_geometryArena.reset();
+
+    m_frameUniforms.Destroy();
+    m_cameraUniforms.Destroy();
+    m_lightUniforms.Destroy();
+    m_materialUniforms.Destroy();
+    m_clusterUniforms.Destroy();
+    for (UniformBuffer& uniforms : m_shadowLayerUniforms) uniforms.Destroy();
+
+    m_clusterLightBuffer.reset();
+    m_clusterRangeBuffer.reset();
+    m_clusterIndexBuffer.reset();
+
     shadowMap.reset();
-    m_meshCache.Clear();
+    m_sharedMeshes.clear();
     m_skybox.reset();
     m_wallSystem.reset();
     m_loadedModels.clear();
 
-    m_textures.reset();
-    m_shaderManager.reset();
+    m_solidColorShader.reset();
+    m_depthShader.reset();
+    m_pbrShader.reset();
 
     m_backend = nullptr;
     m_backendType = BackendType::UNDEFINED;
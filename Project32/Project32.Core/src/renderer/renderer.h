@@ -11,6 +11,20 @@
 #include "../core/window.h"
 #include "render_data.h"
 #include "lighting.h"
+#include "uniform_blocks.h"
+#include "shadow_cascades.h"
+#include "shadow_cache.h"
+#include "light_clusters.h"
+#include "frame_snapshot.h"
+#include "command_buffer.h"
+#include "instancing.h"
+#include "culling.h"
+#include "occlusion.h"
+#include "mesh_lod.h"
+#include "render_graph.h"
+#include "shared_resources.h"
+#include "../core/system_graph.h"
+#include "../core/telemetry.h"
 
 class Window;
 class Skybox;
@@ -42,22 +56,28 @@ public:
     void SetFOV(float fov) { m_settings.fov = glm::clamp(fov, 30.0f, 120.0f); }
 
     LightingSystem* GetLightingSystem() { return m_lightingSystem.get(); }
+    SystemGraph* GetFrameGraph() const { return m_frameGraph.get(); }
 
 private:
     Window* m_window;
     IGraphicsBackend* m_backend;
     BackendType m_backendType;
 
-    std::unique_ptr<TextureManager> m_textures;
-    std::unique_ptr<ShaderManager> m_shaderManager;
+    // Shared with every other renderer through SharedResources
+    std::shared_ptr<Shader> m_solidColorShader;
+    std::shared_ptr<Shader> m_depthShader;
+    std::shared_ptr<Shader> m_pbrShader;
+    std::vector<std::shared_ptr<Mesh>> m_sharedMeshes;
+
+    // Slot of this window's context, picks the vertex arrays of shared meshes
+    uint32_t m_contextSlot = 0;
+
     std::unique_ptr<ShadowMap> shadowMap;
     std::unique_ptr<LightingSystem> m_lightingSystem;
 
     CameraManager m_cameraManager;
     SceneManager& m_sceneManager;
 
-    MeshCache m_meshCache;
-
     std::vector<std::unique_ptr<ModelImporter::LoadedModel>> m_loadedModels;
     std::unique_ptr<Skybox> m_skybox;
     std::unique_ptr<WallSystem> m_wallSystem;
@@ -67,8 +87,144 @@ private:
 
     static constexpr int GRID_SIZE = 40;
 
-    void RenderSceneObjects(Shader* shader, const glm::mat4& view,
-        const glm::mat4& projection);
+    // Inputs of the frame graph systems, filled on the render thread before
+    // the graph runs
+    struct FrameState {
+        const FrameSnapshot* snapshot = nullptr;
+        Shader* depthShader = nullptr;
+        Shader* pbrShader = nullptr;
+        int width = 0;
+        int height = 0;
+
+        glm::vec3 cameraPos{ 0.0f };
+        glm::vec3 cameraRot{ 0.0f };
+        glm::vec3 cameraForward{ 0.0f, 0.0f, -1.0f };
+        float fovY = glm::radians(90.0f);
+        float aspect = 1.0f;
+        float nearPlane = 0.1f;
+        float farPlane = 1000.0f;
+        glm::mat4 view{ 1.0f };
+        glm::mat4 projection{ 1.0f };
+
+        glm::vec3 lightPos{ 5.0f, 10.0f, 5.0f };
+        glm::vec3 lightTarget{ 0.0f, 2.0f, 0.0f };
+        glm::vec3 lightDirection{ 0.0f, -1.0f, 0.0f };
+
+        float time = 0.0f;
+        float deltaTime = 0.0f;
+        uint64_t frameIndex = 0;
+    };
+
+    FrameState m_frame;
+
+    // LOD chain of every shape, built once at Init, and the same meshes
+    // flattened by GetMeshSlot for the draw keys
+    std::array<MeshLodChain, RENDER_SHAPE_COUNT> m_shapeLods;
+    std::array<Mesh*, MESH_SLOT_COUNT> m_meshSlots{};
+    LodSelector m_lodSelector;
+
+    std::unique_ptr<SystemGraph> m_frameGraph;
+    std::vector<FrameStats> m_telemetryHistory;
+
+    // Light projections of this frame, one per layer of the shadow map
+    ShadowCascades m_cascades;
+    ShadowCache m_shadowCache;
+
+    // Everything one layer of the shadow map draws. With the shadow cache
+    // on, casters only holds dynamic objects and the static ones are
+    // recorded only on frames where the cache has to re-render the layer.
+    struct ShadowLayerPass {
+        std::vector<uint32_t> casters;
+        std::vector<uint32_t> staticCasters;
+        DrawList drawList;
+        DrawList staticDrawList;
+        InstanceBatchRange batches;
+        InstanceBatchRange staticBatches;
+        CommandBuffer commands;
+        CommandBuffer staticCommands;
+        bool rebuildStatic = false;
+    };
+
+    // Snapshot bounds in SoA form, culled once against the camera and once
+    // against each shadow cascade
+    CullingBounds m_cullBounds;
+    FrustumCuller m_cameraCuller;
+    FrustumCuller m_shadowCuller;
+    std::vector<uint32_t> m_visibleObjects;
+    CullingStats m_cameraCullStats;
+    CullingStats m_shadowCullStats;
+
+    // Largest visible boxes drawn into a CPU depth buffer, whatever they
+    // hide is dropped from m_visibleObjects before the scene draw list
+    OcclusionCuller m_occlusion;
+    std::vector<std::pair<float, uint32_t>> m_occluderCandidates;
+
+    // Keyed and radix sorted per pass before batching
+    std::array<ShadowLayerPass, MAX_SHADOW_CASCADES> m_shadowPasses;
+    DrawList m_sceneDrawList;
+
+    // Shadow and scene instances and their indirect commands share one
+    // region of the stream buffer per frame, m_replay says where
+    InstanceBatcher m_instances;
+    InstanceBatchRange m_sceneBatches;
+    bool m_recordIndirect = false;
+    std::unique_ptr<StreamBuffer> m_instanceStream;
+    CommandReplayContext m_replay;
+
+    // Null when the context cannot multi-draw indirect
+    std::unique_ptr<GeometryArena> m_geometryArena;
+
+    static constexpr size_t INSTANCE_STREAM_REGION_SIZE = 1024 * 1024;
+
+    CommandBuffer m_sceneCommands;
+
+    // GPU passes of the frame, declared again every frame in
+    // BuildRenderGraph. The pool keeps the transient textures between
+    // frames.
+    RenderGraph m_renderGraph;
+    RenderTargetPool m_renderTargets;
+
+    // std140 blocks shared by every shader, bound at the bindings in
+    // uniform_blocks.h
+    UniformBuffer m_frameUniforms;
+    UniformBuffer m_cameraUniforms;
+    UniformBuffer m_lightUniforms;
+    UniformBuffer m_materialUniforms;
+    UniformBuffer m_clusterUniforms;
+    std::array<UniformBuffer, MAX_SHADOW_CASCADES> m_shadowLayerUniforms;
+
+    // Point and spot lights of this frame and the froxel grid over them,
+    // read by the shaders through buffer textures
+    std::vector<GpuLight> m_clusterLights;
+    LightClusterGrid m_lightClusters;
+    std::unique_ptr<TextureBuffer> m_clusterLightBuffer;
+    std::unique_ptr<TextureBuffer> m_clusterRangeBuffer;
+    std::unique_ptr<TextureBuffer> m_clusterIndexBuffer;
+
+    void CreateShapeLods();
+    void BuildFrameGraph();
+    void UpdateShadowCascades();
+    void BuildCullingBounds();
+    void SelectMeshLods();
+    const std::vector<uint8_t>* GetMeshLods() const;
+    void CullCamera();
+    void CullOcclusion();
+    void CullShadowCasters();
+    void BuildShadowDrawList();
+    void BuildSceneDrawList();
+    void BuildInstances();
+    void RecordShadowLayer(uint32_t layer);
+    void RecordScene();
+    bool UploadInstances();
+    void CreateUniformBuffers();
+    void CreateLightClusterBuffers();
+    void BuildLightClusters();
+    void UploadUniforms();
+    void UploadLightClusters();
+    void BuildRenderGraph(bool instancesReady);
+    void SubmitFrame();
+    void RenderFrameUI();
+    void RenderTelemetryUI(const FrameTelemetry& telemetry);
     void RenderDebugUI(const glm::vec3& cameraPos, const glm::vec3& cameraRot);
 };
 
@@ -0,0 +1,76 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "shadow_cache.h"
+#include "frame_snapshot.h"
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    // FNV-1a
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void ShadowCache::BeginFrame(uint32_t layerCount) {
+    if (layerCount == _layerCount) return;
+
+    _layerCount = layerCount;
+    Invalidate();
+}
+
+bool ShadowCache::Validate(uint32_t layer, const glm::mat4& viewProjection, uint64_t staticHash) {
+    if (layer >= MAX_SHADOW_CASCADES) return true;
+
+    Layer& cached = _layers[layer];
+    if (cached.valid && cached.viewProjection == viewProjection && cached.staticHash == staticHash) {
+        ++_stats.hits;
+        return false;
+    }
+
+    if (cached.valid) {
+        if (cached.viewProjection != viewProjection) ++_stats.lightInvalidations;
+        else ++_stats.staticInvalidations;
+    }
+
+    cached.viewProjection = viewProjection;
+    cached.staticHash = staticHash;
+    cached.valid = true;
+    ++_stats.rebuilds;
+    return true;
+}
+
+void ShadowCache::Invalidate() {
+    bool anyValid = false;
+    for (Layer& layer : _layers) {
+        anyValid |= layer.valid;
+        layer.valid = false;
+    }
+    if (anyValid) ++_stats.forcedInvalidations;
+}
+
+uint64_t ShadowCache::HashStaticCasters(const std::vector<RenderObjectSnapshot>& objects,
+    const std::vector<uint32_t>& casters, const std::vector<uint8_t>* meshLods) {
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t index : casters) {
+        const RenderObjectSnapshot& object = objects[index];
+        if (!object.isStatic) continue;
+
+        hash = HashBytes(hash, &object.objectID, sizeof(object.objectID));
+        hash = HashBytes(hash, &object.shape, sizeof(object.shape));
+        hash = HashBytes(hash, &object.model, sizeof(object.model));
+        if (meshLods) hash = HashBytes(hash, &(*meshLods)[index], sizeof(uint8_t));
+    }
+    return hash;
+}
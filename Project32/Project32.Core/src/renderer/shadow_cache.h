@@ -0,0 +1,64 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef SHADOW_CACHE_H
+#define SHADOW_CACHE_H
+
+#include "../common.h"
+#include "shadow_cascades.h"
+
+struct RenderObjectSnapshot;
+
+struct ShadowCacheStats {
+    uint64_t lightInvalidations = 0;    // light or cascade projection moved
+    uint64_t staticInvalidations = 0;   // a static caster moved, appeared or left
+    uint64_t forcedInvalidations = 0;   // layer count, settings or a lost frame
+    uint64_t rebuilds = 0;              // layers whose static depth was re-rendered
+    uint64_t hits = 0;                  // layers served from the cache
+};
+
+// Remembers what the static depth of each shadow map layer was rendered
+// with. A layer is re-rendered when its light projection or the set of
+// static casters inside it changes, everything else only draws the dynamic
+// casters on top of the cached depth. Touches no graphics state.
+class ShadowCache {
+private:
+    struct Layer {
+        glm::mat4 viewProjection{ 1.0f };
+        uint64_t staticHash = 0;
+        bool valid = false;
+    };
+
+    std::array<Layer, MAX_SHADOW_CASCADES> _layers{};
+    uint32_t _layerCount = 0;
+    ShadowCacheStats _stats;
+
+public:
+    // Drops every layer when the count changes, the shadow map is
+    // reallocated in that case
+    void BeginFrame(uint32_t layerCount);
+
+    // True when the static casters of the layer have to be re-rendered this
+    // frame, the layer counts as valid from then on
+    bool Validate(uint32_t layer, const glm::mat4& viewProjection, uint64_t staticHash);
+
+    void Invalidate();
+
+    const ShadowCacheStats& GetStats() const { return _stats; }
+
+    // Identity, transform and LOD level of every static object in casters
+    static uint64_t HashStaticCasters(const std::vector<RenderObjectSnapshot>& objects,
+        const std::vector<uint32_t>& casters, const std::vector<uint8_t>* meshLods = nullptr);
+};
+
+#endif // SHADOW_CACHE_H
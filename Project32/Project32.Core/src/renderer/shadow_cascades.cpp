@@ -0,0 +1,103 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "shadow_cascades.h"
+
+float ShadowCascades::GetSplitDistance(uint32_t index, uint32_t count, float lambda, float nearPlane, float farPlane) {
+    if (index == 0) return nearPlane;
+    if (index >= count) return farPlane;
+
+    // Practical split scheme, a blend of logarithmic and uniform splits
+    float p = static_cast<float>(index) / static_cast<float>(count);
+    float logSplit = nearPlane * std::pow(farPlane / nearPlane, p);
+    float uniformSplit = nearPlane + (farPlane - nearPlane) * p;
+    return glm::mix(uniformSplit, logSplit, glm::clamp(lambda, 0.0f, 1.0f));
+}
+
+void ShadowCascades::Update(const ShadowCascadeSettings& settings,
+    const glm::mat4& view, float fovY, float aspect,
+    float nearPlane, float farPlane,
+    const glm::vec3& lightDirection) {
+    _count = glm::clamp<uint32_t>(settings.cascadeCount, 1, MAX_SHADOW_CASCADES);
+
+    nearPlane = std::max(nearPlane, 0.001f);
+    float shadowFar = glm::clamp(settings.maxDistance, nearPlane + 0.001f, farPlane);
+    float resolution = static_cast<float>(std::max<uint32_t>(settings.resolution, 1));
+
+    glm::vec3 direction = glm::normalize(lightDirection);
+    glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+    // Rotation only, snapping happens in this space
+    glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), direction, up);
+    glm::mat4 inverseRotation = glm::inverse(lightRotation);
+    glm::mat4 inverseView = glm::inverse(view);
+
+    float tanHalfY = std::tan(fovY * 0.5f);
+    float tanHalfX = tanHalfY * aspect;
+
+    for (uint32_t i = 0; i < _count; ++i) {
+        ShadowCascade& cascade = _cascades[i];
+        cascade.splitNear = GetSplitDistance(i, _count, settings.splitLambda, nearPlane, shadowFar);
+        cascade.splitFar = GetSplitDistance(i + 1, _count, settings.splitLambda, nearPlane, shadowFar);
+
+        std::array<glm::vec3, 8> corners;
+        size_t corner = 0;
+        for (float depth : { cascade.splitNear, cascade.splitFar }) {
+            for (float sy : { -1.0f, 1.0f }) {
+                for (float sx : { -1.0f, 1.0f }) {
+                    glm::vec4 viewPos(sx * tanHalfX * depth, sy * tanHalfY * depth, -depth, 1.0f);
+                    corners[corner++] = glm::vec3(inverseView * viewPos);
+                }
+            }
+        }
+
+        glm::vec3 center(0.0f);
+        for (const glm::vec3& c : corners) center += c;
+        center /= static_cast<float>(corners.size());
+
+        float radius = 0.0f;
+        for (const glm::vec3& c : corners) radius = std::max(radius, glm::length(c - center));
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        // Move the center in whole texels of this cascade
+        float texelsPerUnit = resolution / (radius * 2.0f);
+        glm::vec3 lightCenter = glm::vec3(lightRotation * glm::vec4(center, 1.0f));
+        lightCenter.x = std::floor(lightCenter.x * texelsPerUnit) / texelsPerUnit;
+        lightCenter.y = std::floor(lightCenter.y * texelsPerUnit) / texelsPerUnit;
+        center = glm::vec3(inverseRotation * glm::vec4(lightCenter, 1.0f));
+
+        // Pulled back past the slice so casters between it and the light land in the map
+        float backOff = radius + settings.casterDistance;
+        glm::vec3 eye = center - direction * backOff;
+
+        glm::mat4 lightView = glm::lookAt(eye, center, up);
+        glm::mat4 lightProjection = glm::ortho(-radius, radius, -radius, radius, 0.0f, backOff + radius);
+
+        cascade.viewProjection = lightProjection * lightView;
+        cascade.lightOrigin = eye;
+        cascade.depthRange = backOff + radius;
+        cascade.radius = radius;
+    }
+}
+
+void ShadowCascades::SetFixed(const glm::mat4& viewProjection, const glm::vec3& lightOrigin,
+    float depthRange, float farPlane) {
+    _count = 1;
+
+    ShadowCascade& cascade = _cascades[0];
+    cascade.viewProjection = viewProjection;
+    cascade.lightOrigin = lightOrigin;
+    cascade.depthRange = depthRange;
+    cascade.splitNear = 0.0f;
+    cascade.splitFar = farPlane;
+    cascade.radius = 0.0f;
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef SHADOW_CASCADES_H
+#define SHADOW_CASCADES_H
+
+#include "../common.h"
+
+constexpr uint32_t MAX_SHADOW_CASCADES = 4;
+
+struct ShadowCascadeSettings {
+    uint32_t cascadeCount = 4;
+    float splitLambda = 0.75f;      // 0 uniform splits, 1 logarithmic splits
+    float maxDistance = 100.0f;     // shadows end here even if the camera sees further
+    float casterDistance = 50.0f;   // how far behind a slice casters are still caught
+    uint32_t resolution = 2048;
+};
+
+struct ShadowCascade {
+    glm::mat4 viewProjection{ 1.0f };
+    glm::vec3 lightOrigin{ 0.0f };  // eye of the light view, depth is measured from here
+    float depthRange = 0.0f;
+    float splitNear = 0.0f;         // view space distances covered by the cascade
+    float splitFar = 0.0f;
+    float radius = 0.0f;
+};
+
+// Splits the camera frustum into depth slices and fits a directional light
+// projection around each one. Every slice is bounded by a sphere, so the
+// projection size does not change as the camera turns, and the light space
+// center is snapped to whole shadow map texels so the edges do not shimmer
+// while the camera moves. Pure math, needs no graphics context.
+class ShadowCascades {
+private:
+    std::array<ShadowCascade, MAX_SHADOW_CASCADES> _cascades{};
+    uint32_t _count = 0;
+
+public:
+    void Update(const ShadowCascadeSettings& settings,
+        const glm::mat4& view, float fovY, float aspect,
+        float nearPlane, float farPlane,
+        const glm::vec3& lightDirection);
+
+    // Single cascade with a caller supplied light matrix covering all depths
+    void SetFixed(const glm::mat4& viewProjection, const glm::vec3& lightOrigin,
+        float depthRange, float farPlane);
+
+    uint32_t GetCount() const { return _count; }
+    const ShadowCascade& GetCascade(uint32_t index) const { return _cascades[index]; }
+
+    static float GetSplitDistance(uint32_t index, uint32_t count, float lambda, float nearPlane, float farPlane);
+};
+
+#endif // SHADOW_CASCADES_H
@@ -0,0 +1,117 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "shared_resources.h"
+#include "../BackEnd/backend.h"
+#include "../BackEnd/OpenGL/GL_common.h"
+
+SharedResources& SharedResources::Get() {
+    static SharedResources instance;
+    return instance;
+}
+
+template<typename T>
+std::shared_ptr<T> SharedResources::Find(Registry<T>& registry, const std::string& key) {
+    auto it = registry.find(key);
+    if (it == registry.end()) return nullptr;
+
+    std::shared_ptr<T> resource = it->second.lock();
+    if (!resource) {
+        registry.erase(it);
+        return nullptr;
+    }
+
+    ++_hits;
+    return resource;
+}
+
+void SharedResources::PublishObjects() {
+    // Another context may only rely on the contents once the commands that
+    // wrote them finished, this only runs when something was loaded
+    if (!GraphicsBackend::IsHeadless() && glfwGetCurrentContext()) glFinish();
+}
+
+std::shared_ptr<Shader> SharedResources::AcquireShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (std::shared_ptr<Shader> shader = Find(_shaders, name)) return shader;
+
+    auto shader = std::make_shared<Shader>();
+    shader->Load(vertexPath, fragmentPath);
+    if (!shader->IsValid()) {
+        spdlog::error("[SharedResources::AcquireShader] Failed to load shader '{}'", name);
+        return nullptr;
+    }
+
+    PublishObjects();
+    _shaders[name] = shader;
+    ++_loads;
+    spdlog::info("[SharedResources] Loaded shader '{}'", name);
+    return shader;
+}
+
+std::shared_ptr<Texture> SharedResources::AcquireTexture(const std::string& name, const std::string& filepath, bool flipVertically) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (std::shared_ptr<Texture> texture = Find(_textures, name)) return texture;
+
+    auto texture = std::make_shared<Texture>(name);
+    if (!texture->LoadFromFile(name, filepath, flipVertically)) {
+        spdlog::error("[SharedResources::AcquireTexture] Failed to load texture '{}' from {}", name, filepath);
+        return nullptr;
+    }
+
+    PublishObjects();
+    _textures[name] = texture;
+    ++_loads;
+    spdlog::info("[SharedResources] Loaded texture '{}'", name);
+    return texture;
+}
+
+std::shared_ptr<Mesh> SharedResources::AcquireMesh(const std::string& key, const MeshFactory& factory) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (std::shared_ptr<Mesh> mesh = Find(_meshes, key)) return mesh;
+
+    std::unique_ptr<Mesh> created = factory ? factory() : nullptr;
+    if (!created || !created->IsValid()) {
+        spdlog::error("[SharedResources::AcquireMesh] Factory returned no valid mesh for key: {}", key);
+        return nullptr;
+    }
+
+    created->SetName(key);
+    std::shared_ptr<Mesh> mesh(std::move(created));
+
+    PublishObjects();
+    _meshes[key] = mesh;
+    ++_loads;
+    spdlog::debug("[SharedResources] Created mesh '{}'", key);
+    return mesh;
+}
+
+SharedResourceStats SharedResources::GetStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    SharedResourceStats stats;
+    for (const auto& [key, weak] : _meshes) {
+        if (std::shared_ptr<Mesh> mesh = weak.lock()) {
+            ++stats.meshes;
+            stats.meshBytes += mesh->GetStats().memoryUsage;
+        }
+    }
+    for (const auto& [key, weak] : _textures) {
+        if (!weak.expired()) ++stats.textures;
+    }
+    for (const auto& [key, weak] : _shaders) {
+        if (!weak.expired()) ++stats.shaders;
+    }
+    stats.hits = _hits;
+    stats.loads = _loads;
+    return stats;
+}
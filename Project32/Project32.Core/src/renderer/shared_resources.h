@@ -0,0 +1,79 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef SHARED_RESOURCES_H
+#define SHARED_RESOURCES_H
+
+#include "../common.h"
+
+class Mesh;
+class Shader;
+class Texture;
+
+struct SharedResourceStats {
+    uint32_t meshes = 0;
+    uint32_t textures = 0;
+    uint32_t shaders = 0;
+    uint64_t hits = 0;          // acquires served by an existing resource
+    uint64_t loads = 0;
+    size_t meshBytes = 0;
+};
+
+// Meshes, textures and shader programs shared by every renderer in the
+// process. All engine windows share one GL object namespace (see Window),
+// so whatever one renderer loaded the next one gets for free.
+//
+// The registry only keeps weak references, a resource lives as long as
+// somebody holds the shared_ptr from Acquire and is destroyed with the
+// last holder, on whichever context that holder has current. Acquire can
+// be called from any render thread; a missing resource is created under
+// the lock on the calling thread, so its context has to be current.
+class SharedResources {
+public:
+    using MeshFactory = std::function<std::unique_ptr<Mesh>()>;
+
+    static SharedResources& Get();
+
+    SharedResources(const SharedResources&) = delete;
+    SharedResources& operator=(const SharedResources&) = delete;
+
+    // Null when the resource failed to load
+    std::shared_ptr<Shader> AcquireShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
+    std::shared_ptr<Texture> AcquireTexture(const std::string& name, const std::string& filepath, bool flipVertically = true);
+    std::shared_ptr<Mesh> AcquireMesh(const std::string& key, const MeshFactory& factory);
+
+    // Live resources only, expired entries are not counted
+    SharedResourceStats GetStats() const;
+
+private:
+    SharedResources() = default;
+
+    template<typename T>
+    using Registry = std::unordered_map<std::string, std::weak_ptr<T>>;
+
+    mutable std::mutex _mutex;
+    Registry<Mesh> _meshes;
+    Registry<Texture> _textures;
+    Registry<Shader> _shaders;
+    uint64_t _hits = 0;
+    uint64_t _loads = 0;
+
+    template<typename T>
+    std::shared_ptr<T> Find(Registry<T>& registry, const std::string& key);
+
+    // Makes objects created on this thread visible to the other contexts
+    // before they first bind them
+    static void PublishObjects();
+};
+
+#endif // SHARED_RESOURCES_H
@@ -0,0 +1,71 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "uniform_blocks.h"
+
+UniformBuffer::~UniformBuffer() {
+    Destroy();
+}
+
+void UniformBuffer::Create(IGraphicsBackend* backend, uint32_t binding, size_t size) {
+    if (!backend) {
+        throw std::runtime_error("UniformBuffer requires a graphics backend");
+    }
+
+    Destroy();
+
+    _backend = backend;
+    _binding = binding;
+    _buffer = backend->CreateUniformBuffer(size);
+    _contents.assign(size, 0);
+    _uploaded = false;
+
+    if (_buffer == 0) {
+        throw std::runtime_error("Failed to create uniform buffer for binding " + std::to_string(binding));
+    }
+}
+
+void UniformBuffer::Destroy() {
+    if (_backend && _buffer != 0) {
+        _backend->DeleteBuffer(_buffer);
+    }
+
+    _backend = nullptr;
+    _buffer = 0;
+    _contents.clear();
+    _uploaded = false;
+}
+
+bool UniformBuffer::Update(const void* data, size_t size) {
+    if (!_backend || _buffer == 0) return false;
+
+    if (size != _contents.size()) {
+        spdlog::error("[UniformBuffer::Update] Block at binding {} is {} bytes, got {}",
+            _binding, _contents.size(), size);
+        return false;
+    }
+
+    if (_uploaded && std::memcmp(_contents.data(), data, size) == 0) {
+        return false;
+    }
+
+    std::memcpy(_contents.data(), data, size);
+    _backend->UpdateBufferSubData(_buffer, data, size);
+    _uploaded = true;
+    return true;
+}
+
+void UniformBuffer::Bind() const {
+    if (_backend && _buffer != 0) {
+        _backend->BindUniformBuffer(_buffer, _binding);
+    }
+}
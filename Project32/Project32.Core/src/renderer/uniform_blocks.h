@@ -0,0 +1,144 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef UNIFORM_BLOCKS_H
+#define UNIFORM_BLOCKS_H
+
+#include "../common.h"
+#include "shadow_cascades.h"
+
+class IGraphicsBackend;
+
+// Binding points of the std140 blocks declared in res/shaders. The structs
+// below mirror those declarations member for member, only vec4/ivec4/mat4
+// are used so the C++ layout matches std140 without manual padding.
+namespace UniformBinding {
+    constexpr uint32_t Frame = 0;
+    constexpr uint32_t Camera = 1;
+    constexpr uint32_t Lights = 2;
+    constexpr uint32_t Material = 3;
+    constexpr uint32_t Clusters = 4;
+    constexpr uint32_t ShadowLayer = 5;
+}
+
+// Texture units the shaders bind their samplers to
+namespace TextureUnit {
+    constexpr int Albedo = 0;
+    constexpr int ShadowMap = 1;
+    constexpr int Normal = 2;
+    constexpr int Metallic = 3;
+    constexpr int Roughness = 4;
+    constexpr int AO = 5;
+    constexpr int ClusterLights = 6;
+    constexpr int ClusterRanges = 7;
+    constexpr int ClusterIndices = 8;
+}
+
+constexpr int MAX_GPU_LIGHTS = 8;
+
+struct FrameBlock {
+    glm::mat4 cascadeMatrices[MAX_SHADOW_CASCADES]{};
+    glm::vec4 cascadeSplits{ 0.0f };    // view space far distance of each cascade
+    glm::ivec4 shadowInfo{ 0 };         // x cascade count
+    glm::vec4 time{ 0.0f };             // seconds, delta, frame index
+};
+
+struct CameraBlock {
+    glm::mat4 view{ 1.0f };
+    glm::mat4 projection{ 1.0f };
+    glm::mat4 viewProjection{ 1.0f };
+    glm::vec4 position{ 0.0f };
+};
+
+struct GpuLight {
+    glm::vec4 positionRange{ 0.0f };    // xyz position, w range
+    glm::vec4 colorType{ 0.0f };        // rgb color * intensity, w LightType
+    glm::vec4 directionShadow{ 0.0f };  // xyz direction, w casts shadows
+    glm::vec4 spotCutoff{ 0.0f };       // x inner cos, y outer cos
+};
+
+struct LightBlock {
+    GpuLight lights[MAX_GPU_LIGHTS];
+    glm::ivec4 count{ 0 };              // x light count
+};
+
+// Lookup parameters of the clustered light grid, the grid itself lives in
+// buffer textures (see LightClusterGrid)
+struct ClusterBlock {
+    glm::uvec4 grid{ 0u };              // xyz cluster counts, w clustered light count
+    glm::vec4 depth{ 0.0f };            // near, far, slice scale, slice bias
+    glm::vec4 tile{ 0.0f };             // tile size in pixels
+};
+
+// Layer a shadow pass renders. Shader programs are shared between the
+// contexts of all windows, so per pass values go through a binding point,
+// which is context state, instead of a program uniform.
+struct ShadowLayerBlock {
+    glm::ivec4 layer{ 0 };              // x cascade index
+};
+
+struct MaterialBlock {
+    glm::vec4 albedo{ 1.0f };
+    glm::vec4 params{ 0.0f, 0.5f, 1.0f, 0.0f };    // metallic, roughness, ao
+    glm::ivec4 maps{ 0 };               // albedo, normal, metallic, roughness
+    glm::ivec4 extraMaps{ 0 };          // ao
+};
+
+static_assert(sizeof(FrameBlock) == 64 * MAX_SHADOW_CASCADES + 48, "FrameBlock must match the std140 layout");
+static_assert(sizeof(CameraBlock) == 208, "CameraBlock must match the std140 layout");
+static_assert(sizeof(GpuLight) == 64, "GpuLight must match the std140 layout");
+static_assert(sizeof(LightBlock) == 64 * MAX_GPU_LIGHTS + 16, "LightBlock must match the std140 layout");
+static_assert(sizeof(ClusterBlock) == 48, "ClusterBlock must match the std140 layout");
+static_assert(sizeof(ShadowLayerBlock) == 16, "ShadowLayerBlock must match the std140 layout");
+static_assert(sizeof(MaterialBlock) == 64, "MaterialBlock must match the std140 layout");
+
+// Buffer behind one uniform block. Created once with fixed storage and
+// rewritten in place; Update keeps a CPU copy and skips the upload when
+// the contents did not change, so blocks that rarely change (lights,
+// material) cost nothing on most frames.
+class UniformBuffer {
+private:
+    IGraphicsBackend* _backend = nullptr;
+    unsigned int _buffer = 0;
+    uint32_t _binding = 0;
+    std::vector<uint8_t> _contents;
+    bool _uploaded = false;
+
+public:
+    UniformBuffer() = default;
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    void Create(IGraphicsBackend* backend, uint32_t binding, size_t size);
+    void Destroy();
+
+    // Returns true when the data was actually uploaded
+    bool Update(const void* data, size_t size);
+
+    template<typename T>
+    bool Update(const T& block) {
+        static_assert(std::is_trivially_copyable_v<T>, "Uniform blocks must be trivially copyable");
+        static_assert(sizeof(T) % 16 == 0, "Uniform blocks must be a multiple of 16 bytes");
+        return Update(&block, sizeof(T));
+    }
+
+    // Binding points are context state, so this runs every frame the block is used
+    void Bind() const;
+
+    bool IsValid() const { return _buffer != 0; }
+    uint32_t GetBinding() const { return _binding; }
+};
+
+#endif // UNIFORM_BLOCKS_H
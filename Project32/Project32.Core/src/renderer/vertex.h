@@ -35,6 +35,26 @@ struct Vertex {
     }
 };
 
+// Per-instance attributes, read with divisor 1 from locations 6 to 11
+struct InstanceData {
+    glm::mat4 model{ 1.0f };     // 6-9
+    glm::vec4 color{ 1.0f };     // 10, rgb tint
+    glm::vec4 material{ 0.0f, 0.5f, 1.0f, 0.0f };  // 11, metallic, roughness, ao
+};
+
+static_assert(sizeof(InstanceData) == 96, "InstanceData layout must match the shader attributes");
+
+// Layout of DrawElementsIndirectCommand as read by glMultiDrawElementsIndirect
+struct IndirectDrawCommand {
+    uint32_t indexCount = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstIndex = 0;
+    uint32_t baseVertex = 0;
+    uint32_t baseInstance = 0;
+};
+
+static_assert(sizeof(IndirectDrawCommand) == 20, "IndirectDrawCommand must match DrawElementsIndirectCommand");
+
 inline void CalculateTangents(std::vector<Vertex>& vertices,
     const std::vector<unsigned int>& indices) {
     for (auto& vertex : vertices) {
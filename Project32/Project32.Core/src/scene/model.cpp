@@ -40,7 +40,8 @@ void ModelImporter::LoadedModel::CalculateBounds() {
 std::unique_ptr<ModelImporter::LoadedModel> ModelImporter::LoadFromFile(
     const std::string& filePath,
     bool generateNormals,
-    bool flipTextureCoords) {
+    bool flipTextureCoords,
+    bool generateLods) {
 
     auto model = std::make_unique<LoadedModel>();
 
@@ -81,7 +82,7 @@ std::unique_ptr<ModelImporter::LoadedModel> ModelImporter::LoadFromFile(
 
     for (size_t s = 0; s < shapes.size(); s++) {
         ProcessShape(attrib, shapes[s], model.get(), s,
-            generateNormals, flipTextureCoords);
+            generateNormals, flipTextureCoords, generateLods);
     }
 
     model->CalculateBounds();
@@ -104,7 +105,8 @@ void ModelImporter::ProcessShape(
     LoadedModel* model,
     size_t shapeIndex,
     bool generateNormals,
-    bool flipTextureCoords) {
+    bool flipTextureCoords,
+    bool generateLods) {
 
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
@@ -190,9 +192,57 @@ void ModelImporter::ProcessShape(
     spdlog::info("[ModelImporter] Shape {}: '{}' - {} vertices, {} triangles",
         shapeIndex, mesh->GetName(), vertices.size(), indices.size() / 3);
 
+    if (generateLods) {
+        GenerateLods(vertices, indices, model, mesh.get());
+    }
+    else {
+        MeshLodChain chain;
+        chain.AddLevel(mesh.get(), 0.0f);
+        model->lods.push_back(chain);
+    }
+
     model->meshes.push_back(std::move(mesh));
 }
 
+void ModelImporter::GenerateLods(const std::vector<Vertex>& vertices,
+    const std::vector<unsigned int>& indices,
+    LoadedModel* model,
+    Mesh* mesh) {
+    MeshLodChain chain;
+    chain.AddLevel(mesh, 0.0f);
+
+    // Past a tenth of the mesh size a level looks like a different object
+    float maxError = mesh->GetBounds().radius * 0.1f;
+    size_t previousCount = indices.size();
+
+    std::vector<unsigned int> simplified;
+    std::vector<Vertex> lodVertices;
+    std::vector<unsigned int> lodIndices;
+
+    // Every level aims for half the triangles of the one before
+    for (uint32_t level = 1; level < MAX_MESH_LODS; ++level) {
+        float error = MeshSimplifier::Simplify(vertices, indices, indices.size() >> level, maxError, simplified);
+
+        // Seams, borders or the error cap stopped it, another level would
+        // cost a mesh and save little
+        if (simplified.empty() || simplified.size() > previousCount * 3 / 4) break;
+        previousCount = simplified.size();
+
+        MeshSimplifier::CompactVertices(vertices, simplified, lodVertices, lodIndices);
+
+        auto lod = std::make_unique<Mesh>(mesh->GetName() + "_LOD" + std::to_string(level));
+        lod->LoadData(lodVertices, lodIndices);
+        chain.AddLevel(lod.get(), error);
+
+        spdlog::debug("[ModelImporter] LOD {} of '{}': {} triangles, error {:.4f}",
+            level, mesh->GetName(), lodIndices.size() / 3, error);
+
+        model->lodMeshes.push_back(std::move(lod));
+    }
+
+    model->lods.push_back(chain);
+}
+
 void ModelImporter::GenerateNormals(std::vector<Vertex>& vertices,
     const std::vector<unsigned int>& indices) {
     for (auto& vertex : vertices) {
@@ -418,6 +468,10 @@ ModelImporter::Stats ModelImporter::LoadedModel::GetStats() const {
         }
     }
 
+    for (const auto& lod : lodMeshes) {
+        if (lod) stats.memoryUsage += lod->GetStats().memoryUsage;
+    }
+
     return stats;
 }
 
@@ -16,6 +16,7 @@
 
 #include "../common.h"
 #include "../renderer/vertex.h"
+#include "../renderer/mesh_lod.h"
 
 namespace tinyobj {
     struct attrib_t;
@@ -36,6 +37,11 @@ public:
         std::vector<std::unique_ptr<Mesh>> meshes;
         std::vector<std::string> materialNames;
 
+        // One chain per mesh, level 0 is the mesh itself and the simplified
+        // levels are owned by lodMeshes
+        std::vector<MeshLodChain> lods;
+        std::vector<std::unique_ptr<Mesh>> lodMeshes;
+
         glm::vec3 minBounds{ FLT_MAX };
         glm::vec3 maxBounds{ -FLT_MAX };
         glm::vec3 center{ 0.0f };
@@ -58,10 +64,13 @@ public:
         void PrintInfo() const;
     };
 
+    // Simplified levels are opt-in, nothing selects model LODs yet so the
+    // default load only builds level 0
     static std::unique_ptr<LoadedModel> LoadFromFile(
         const std::string& filePath,
         bool generateNormals = true,
-        bool flipTextureCoords = true);
+        bool flipTextureCoords = true,
+        bool generateLods = false);
 
 private:
     struct VertexKey {
@@ -98,7 +107,14 @@ private:
         LoadedModel* model,
         size_t shapeIndex,
         bool generateNormals,
-        bool flipTextureCoords);
+        bool flipTextureCoords,
+        bool generateLods);
+
+    static void GenerateLods(
+        const std::vector<Vertex>& vertices,
+        const std::vector<unsigned int>& indices,
+        LoadedModel* model,
+        Mesh* mesh);
 
     static void GenerateNormals(
         std::vector<Vertex>& vertices,
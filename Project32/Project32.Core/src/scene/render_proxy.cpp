@@ -0,0 +1,70 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "../common.h"
+#include "render_proxy.h"
+
+RenderProxy& RenderProxyStore::GetOrCreate(int objectID, RenderShape shape) {
+    auto it = _indices.find(objectID);
+    if (it != _indices.end()) {
+        return _proxies[it->second];
+    }
+
+    _indices[objectID] = static_cast<uint32_t>(_proxies.size());
+
+    RenderProxy& proxy = _proxies.emplace_back();
+    proxy.objectID = objectID;
+    proxy.shape = shape;
+    return proxy;
+}
+
+RenderProxy* RenderProxyStore::Find(int objectID) {
+    auto it = _indices.find(objectID);
+    return it != _indices.end() ? &_proxies[it->second] : nullptr;
+}
+
+const RenderProxy* RenderProxyStore::Find(int objectID) const {
+    auto it = _indices.find(objectID);
+    return it != _indices.end() ? &_proxies[it->second] : nullptr;
+}
+
+bool RenderProxyStore::Remove(int objectID) {
+    auto it = _indices.find(objectID);
+    if (it == _indices.end()) return false;
+
+    uint32_t index = it->second;
+    _indices.erase(it);
+
+    if (index != _proxies.size() - 1) {
+        _proxies[index] = std::move(_proxies.back());
+        _indices[_proxies[index].objectID] = index;
+    }
+    _proxies.pop_back();
+    return true;
+}
+
+void RenderProxyStore::Clear() {
+    _proxies.clear();
+    _indices.clear();
+    _camera = CameraProxy{};
+}
+
+bool RenderProxyStore::ParseShape(const std::string& name, RenderShape& shape) {
+    if (name == "cube") {
+        shape = RenderShape::Cube;
+        return true;
+    }
+    if (name == "sphere") {
+        shape = RenderShape::Sphere;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef RENDER_PROXY_H
+#define RENDER_PROXY_H
+
+#include "../common.h"
+
+enum class RenderShape : uint8_t {
+    Cube,
+    Sphere
+};
+
+constexpr size_t RENDER_SHAPE_COUNT = 2;
+
+// Native render state of one scripted object, rotation in euler degrees
+struct RenderProxy {
+    int objectID = -1;
+    RenderShape shape = RenderShape::Cube;
+    bool visible = true;
+    bool interpolate = false;
+    bool isStatic = false;      // rarely moves, its shadow depth is cached
+
+    glm::vec3 position{ 0.0f };
+    glm::vec3 rotation{ 0.0f };
+    glm::vec3 scale{ 1.0f };
+
+    glm::vec3 color{ 1.0f };
+    float metallic = 0.0f;
+    float roughness = 0.5f;
+};
+
+struct CameraProxy {
+    bool active = false;
+    glm::vec3 position{ 0.0f, 1.7f, 5.0f };
+    glm::vec3 rotation{ 0.0f };
+};
+
+// Dense array of render proxies keyed by object ID. Scripts write into it
+// through the RenderProxy Lua bindings and snapshot capture walks it linearly.
+// Owned by the engine and only touched from its update thread.
+class RenderProxyStore {
+private:
+    std::vector<RenderProxy> _proxies;
+    std::unordered_map<int, uint32_t> _indices;
+    CameraProxy _camera;
+
+public:
+    RenderProxy& GetOrCreate(int objectID, RenderShape shape = RenderShape::Cube);
+    RenderProxy* Find(int objectID);
+    const RenderProxy* Find(int objectID) const;
+
+    // Swap-removes, so references into the store are invalidated
+    bool Remove(int objectID);
+    void Clear();
+
+    CameraProxy& GetCamera() { return _camera; }
+    const CameraProxy& GetCamera() const { return _camera; }
+
+    const std::vector<RenderProxy>& GetProxies() const { return _proxies; }
+    size_t GetCount() const { return _proxies.size(); }
+
+    static bool ParseShape(const std::string& name, RenderShape& shape);
+};
+
+#endif // RENDER_PROXY_H
@@ -302,6 +302,26 @@ std::vector<const SceneObject*> Scene::FindObjectsByType(SceneObject::Type type)
     return result;
 }
 
+FrameVector<SceneObject*> Scene::FindObjectsByType(SceneObject::Type type, FrameAllocator& frame) {
+    auto result = frame.MakeVector<SceneObject*>(_objects.size());
+    for (auto& object : _objects) {
+        if (object->GetType() == type) {
+            result.push_back(object.get());
+        }
+    }
+    return result;
+}
+
+FrameVector<const SceneObject*> Scene::FindObjectsByType(SceneObject::Type type, FrameAllocator& frame) const {
+    auto result = frame.MakeVector<const SceneObject*>(_objects.size());
+    for (const auto& object : _objects) {
+        if (object->GetType() == type) {
+            result.push_back(object.get());
+        }
+    }
+    return result;
+}
+
 void Scene::Render() const {
     for (const auto& object : _objects) {
         object->Draw();
@@ -16,6 +16,7 @@
 #define SCENE_H
 
 #include "../common.h"
+#include "../core/frame_allocator.h"
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -135,6 +136,10 @@ public:
     std::vector<SceneObject*> FindObjectsByType(SceneObject::Type type);
     std::vector<const SceneObject*> FindObjectsByType(SceneObject::Type type) const;
 
+    // Same as above but the result lives in frame memory, for per-frame queries
+    FrameVector<SceneObject*> FindObjectsByType(SceneObject::Type type, FrameAllocator& frame);
+    FrameVector<const SceneObject*> FindObjectsByType(SceneObject::Type type, FrameAllocator& frame) const;
+
     void Render() const;
     void RenderObject(const std::string& name) const;
     void RenderObject(uint32_t id) const;
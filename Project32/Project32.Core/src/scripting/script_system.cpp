@@ -38,6 +38,10 @@ bool ScriptComponent::Load() {
             return false;
         }
 
+        bool isCamera = m_scriptTable["isCamera"].valid() && m_scriptTable["isCamera"].get<bool>();
+        bool hasShape = m_scriptTable["size"].valid() || m_scriptTable["radius"].valid();
+        m_legacyRenderFields = isCamera || (m_scriptTable["position"].valid() && hasShape);
+
         if (std::filesystem::exists(m_scriptPath)) {
             m_lastWriteTime = std::filesystem::last_write_time(m_scriptPath);
         }
@@ -165,6 +169,7 @@ void ScriptSystem::Init() {
     ExposeUISystem();
     ExposeRendererSystem();
     ExposeSceneSystem();
+    ExposeRenderProxySystem();
 
     spdlog::info("[ScriptSystem] Lua scripting system initialized successfully");
 }
@@ -247,7 +252,16 @@ void ScriptSystem::ExposeEngineSystems() {
 
     m_lua["Time"] = m_lua.create_table_with(
         "GetDeltaTime", [this]() { return m_engine ? m_engine->GetDeltaTime() : 0.0f; },
-        "GetFrameCount", [this]() { return m_engine ? m_engine->GetFrameCount() : 0; }
+        "GetFrameCount", [this]() { return m_engine ? m_engine->GetFrameCount() : 0; },
+        "GetFixedDeltaTime", [this]() { return m_engine ? m_engine->GetFixedDeltaTime() : 0.0f; },
+        "GetInterpolationAlpha", [this]() { return m_engine ? m_engine->GetInterpolationAlpha() : 0.0f; },
+        "SetFixedUpdateRate", [this](float hz) {
+            if (m_engine) m_engine->SetFixedUpdateRate(hz);
+        },
+        "SetTargetFPS", [this](float fps) {
+            if (m_engine) m_engine->SetTargetFPS(fps);
+        },
+        "GetTargetFPS", [this]() { return m_engine ? m_engine->GetTargetFPS() : 0.0f; }
     );
 
     m_lua["GetScript"] = [this](int objectID) -> sol::optional<sol::table> {
@@ -666,6 +680,185 @@ void ScriptSystem::ExposeSceneSystem() {
     );
 }
 
+void ScriptSystem::ExposeRenderProxySystem() {
+    auto proxies = [this]() -> RenderProxyStore* {
+        return m_engine ? &m_engine->GetRenderProxies() : nullptr;
+        };
+
+    // Setters return false for objects without a proxy so scripts can check
+    m_lua["RenderProxy"] = m_lua.create_table_with(
+        "Create", [proxies](int objectID, sol::optional<std::string> shapeName) -> bool {
+            auto* store = proxies();
+            if (!store) return false;
+
+            RenderShape shape = RenderShape::Cube;
+            if (shapeName && !RenderProxyStore::ParseShape(*shapeName, shape)) {
+                spdlog::warn("[ScriptSystem] Unknown render proxy shape '{}', using cube", *shapeName);
+            }
+            store->GetOrCreate(objectID, shape).shape = shape;
+            return true;
+        },
+
+        "Destroy", [proxies](int objectID) -> bool {
+            auto* store = proxies();
+            return store && store->Remove(objectID);
+        },
+
+        "Exists", [proxies](int objectID) -> bool {
+            auto* store = proxies();
+            return store && store->Find(objectID) != nullptr;
+        },
+
+        "GetCount", [proxies]() -> int {
+            auto* store = proxies();
+            return store ? static_cast<int>(store->GetCount()) : 0;
+        },
+
+        "SetTransform", [proxies](int objectID, glm::vec3 position, glm::vec3 rotation, glm::vec3 scale) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->position = position;
+            proxy->rotation = rotation;
+            proxy->scale = scale;
+            return true;
+        },
+
+        "SetPosition", [proxies](int objectID, glm::vec3 position) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->position = position;
+            return true;
+        },
+
+        "SetRotation", [proxies](int objectID, glm::vec3 rotation) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->rotation = rotation;
+            return true;
+        },
+
+        "SetScale", [proxies](int objectID, glm::vec3 scale) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->scale = scale;
+            return true;
+        },
+
+        "SetColor", [proxies](int objectID, glm::vec3 color) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->color = color;
+            return true;
+        },
+
+        "SetMaterial", [proxies](int objectID, float metallic, float roughness) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->metallic = glm::clamp(metallic, 0.0f, 1.0f);
+            proxy->roughness = glm::clamp(roughness, 0.0f, 1.0f);
+            return true;
+        },
+
+        "SetShape", [proxies](int objectID, const std::string& shapeName) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            RenderShape shape;
+            if (!proxy || !RenderProxyStore::ParseShape(shapeName, shape)) return false;
+            proxy->shape = shape;
+            return true;
+        },
+
+        "SetVisible", [proxies](int objectID, bool visible) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->visible = visible;
+            return true;
+        },
+
+        "SetInterpolate", [proxies](int objectID, bool interpolate) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->interpolate = interpolate;
+            return true;
+        },
+
+        "SetStatic", [proxies](int objectID, bool isStatic) -> bool {
+            auto* store = proxies();
+            RenderProxy* proxy = store ? store->Find(objectID) : nullptr;
+            if (!proxy) return false;
+            proxy->isStatic = isStatic;
+            return true;
+        },
+
+        "SetCamera", [proxies](glm::vec3 position, glm::vec3 rotation) {
+            auto* store = proxies();
+            if (!store) return;
+            CameraProxy& camera = store->GetCamera();
+            camera.active = true;
+            camera.position = position;
+            camera.rotation = rotation;
+        }
+    );
+}
+
+void ScriptSystem::SyncLegacyProxies() {
+    if (!m_engine) return;
+    RenderProxyStore& proxies = m_engine->GetRenderProxies();
+
+    for (auto& [objectID, script] : m_objectScripts) {
+        if (!script || !script->IsLoaded() || !script->UsesLegacyRenderFields()) continue;
+
+        sol::table obj = script->GetScriptTable();
+
+        if (obj["isCamera"].valid() && obj["isCamera"].get<bool>()) {
+            CameraProxy& camera = proxies.GetCamera();
+            camera.active = true;
+            if (obj["cameraPosition"].valid()) {
+                camera.position = obj["cameraPosition"].get<glm::vec3>();
+            }
+            if (obj["cameraRotation"].valid()) {
+                camera.rotation = obj["cameraRotation"].get<glm::vec3>();
+            }
+            continue;
+        }
+
+        if (!obj["position"].valid()) continue;
+
+        RenderShape shape;
+        glm::vec3 scale;
+        if (obj["size"].valid()) {
+            shape = RenderShape::Cube;
+            scale = obj["size"].get<glm::vec3>();
+        }
+        else if (obj["radius"].valid()) {
+            shape = RenderShape::Sphere;
+            scale = glm::vec3(obj["radius"].get<float>());
+        }
+        else {
+            continue;
+        }
+
+        RenderProxy& proxy = proxies.GetOrCreate(objectID, shape);
+        proxy.shape = shape;
+        proxy.scale = scale;
+        proxy.position = obj["position"].get<glm::vec3>();
+        proxy.rotation = obj["rotation"].valid() ? obj["rotation"].get<glm::vec3>() : glm::vec3(0.0f);
+        proxy.color = obj["color"].valid() ? obj["color"].get<glm::vec3>() : glm::vec3(1.0f);
+        proxy.metallic = obj["metallic"].valid() ? obj["metallic"].get<float>() : 0.0f;
+        proxy.roughness = obj["roughness"].valid() ? obj["roughness"].get<float>() : 0.5f;
+        proxy.interpolate = obj["interpolate"].valid() && obj["interpolate"].get<bool>();
+        proxy.isStatic = obj["isStatic"].valid() && obj["isStatic"].get<bool>();
+    }
+}
+
 int ScriptSystem::CreateUIElement(int windowID, const std::string& type, const std::string& label) {
     UIElement element;
     element.id = m_nextUIID++;
@@ -832,6 +1025,8 @@ void ScriptSystem::Update(float dt) {
             script->Update(dt);
         }
     }
+
+    SyncLegacyProxies();
 }
 
 void ScriptSystem::FixedUpdate(float fixedDt) {
@@ -840,6 +1035,8 @@ void ScriptSystem::FixedUpdate(float fixedDt) {
             script->FixedUpdate(fixedDt);
         }
     }
+
+    SyncLegacyProxies();
 }
 
 void ScriptSystem::Shutdown() {
@@ -854,6 +1051,10 @@ void ScriptSystem::Shutdown() {
     m_uiElements.clear();
     m_objectScripts.clear();
     m_scripts.clear();
+
+    if (m_engine) {
+        m_engine->GetRenderProxies().Clear();
+    }
 }
 
 void ScriptSystem::FindAndLoadScriptsInDirectory(const std::string& directoryPath) {
@@ -906,6 +1107,9 @@ void ScriptSystem::DetachScript(int objectID) {
         );
 
         m_objectScripts.erase(it);
+        if (m_engine) {
+            m_engine->GetRenderProxies().Remove(objectID);
+        }
         spdlog::info("[ScriptSystem] Detached script from object {}", objectID);
     }
 }
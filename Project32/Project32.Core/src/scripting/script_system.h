@@ -61,6 +61,10 @@ private:
     std::filesystem::file_time_type m_lastWriteTime;
     int m_objectID;
 
+    // Set when the Script table describes its render state through plain
+    // fields (position, size/radius, isCamera) instead of RenderProxy calls
+    bool m_legacyRenderFields = false;
+
 public:
     ScriptComponent(sol::state* lua, const std::string& scriptPath, int objectID, Engine* engine = nullptr);
     ~ScriptComponent() = default;
@@ -80,6 +84,7 @@ public:
     bool IsLoaded() const { return m_isLoaded; }
     const std::string& GetScriptPath() const { return m_scriptPath; }
     int GetObjectID() const { return m_objectID; }
+    bool UsesLegacyRenderFields() const { return m_legacyRenderFields; }
     bool HasChanged() const;
 
     template<typename... Args>
@@ -112,6 +117,9 @@ private:
     void ExposeUISystem();
     void ExposeRendererSystem();
     void ExposeSceneSystem();
+    void ExposeRenderProxySystem();
+
+    void SyncLegacyProxies();
 
     int CreateUIElement(int windowID, const std::string& type, const std::string& label);
     void RemoveUIElement(int elementID);
@@ -62,6 +62,41 @@ namespace Math {
         return incident - 2.0f * glm::dot(incident, normal) * normal;
 	}
 
+    // Planes point inwards, xyz is the normal and w the distance
+    struct Frustum {
+        std::array<glm::vec4, 6> planes;
+
+        static Frustum FromMatrix(const glm::mat4& viewProjection) {
+            const glm::mat4& m = viewProjection;
+            glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+            glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+            glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+            glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+            Frustum frustum;
+            frustum.planes[0] = row3 + row0;
+            frustum.planes[1] = row3 - row0;
+            frustum.planes[2] = row3 + row1;
+            frustum.planes[3] = row3 - row1;
+            frustum.planes[4] = row3 + row2;
+            frustum.planes[5] = row3 - row2;
+
+            for (glm::vec4& plane : frustum.planes) {
+                plane /= glm::length(glm::vec3(plane));
+            }
+            return frustum;
+        }
+
+        bool IntersectsSphere(const glm::vec3& center, float radius) const {
+            for (const glm::vec4& plane : planes) {
+                if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
 }
 
 #endif // SCENE_H
\ No newline at end of file
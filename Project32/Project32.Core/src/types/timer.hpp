@@ -65,6 +65,10 @@ private:
     float _minDeltaTime = std::numeric_limits<float>::max();
     float _maxDeltaTime = 0.0f;
 
+    // Only guards against huge hitches (breakpoints, window drags). Keeping
+    // simulation speed under load is the fixed-step scheduler's job.
+    float _deltaClamp = 0.25f;
+
 public:
     FrameTimer() {
         float currentTime = static_cast<float>(glfwGetTime());
@@ -77,8 +81,8 @@ public:
         _deltaTime = currentFrame - _lastFrame;
         _lastFrame = currentFrame;
 
-        if (_deltaTime > 1.0f / 30.0f) { 
-            _deltaTime = 1.0f / 30.0f;
+        if (_deltaTime > _deltaClamp) {
+            _deltaTime = _deltaClamp;
         }
 
         _minDeltaTime = std::min(_minDeltaTime, _deltaTime);
@@ -99,6 +103,9 @@ public:
     float GetMaxDeltaTime() const { return _maxDeltaTime; }
     float GetElapsedTime() const { return static_cast<float>(glfwGetTime()) - _startTime; }
 
+    void SetDeltaClamp(float maxDelta) { _deltaClamp = std::max(maxDelta, 0.001f); }
+    float GetDeltaClamp() const { return _deltaClamp; }
+
     void Reset() {
         float currentTime = static_cast<float>(glfwGetTime());
         _startTime = currentTime;
@@ -112,6 +119,152 @@ public:
     }
 };
 
+// Accumulator based fixed-step scheduler. Feed it the real frame delta and
+// run the returned number of steps, each exactly GetStepSize() long. Once the
+// steps are done, GetAlpha() is how far the frame sits between the last two
+// fixed states.
+class FixedTimestep {
+private:
+    double _stepSize = 1.0 / 60.0;
+    double _accumulator = 0.0;
+    int _maxStepsPerFrame = 5;
+    float _alpha = 0.0f;
+
+    uint64_t _totalSteps = 0;
+    uint64_t _droppedSteps = 0;
+    int _lastStepCount = 0;
+
+public:
+    FixedTimestep() = default;
+    explicit FixedTimestep(float rate, int maxStepsPerFrame = 5) {
+        SetRate(rate);
+        SetMaxStepsPerFrame(maxStepsPerFrame);
+    }
+
+    int Advance(float frameDelta) {
+        _accumulator += std::max(0.0f, frameDelta);
+
+        int steps = static_cast<int>(_accumulator / _stepSize);
+        if (steps > _maxStepsPerFrame) {
+            // Too far behind, drop the backlog instead of spiralling
+            _droppedSteps += static_cast<uint64_t>(steps - _maxStepsPerFrame);
+            steps = _maxStepsPerFrame;
+            _accumulator = std::fmod(_accumulator, _stepSize);
+        }
+        else {
+            _accumulator -= steps * _stepSize;
+        }
+
+        _alpha = static_cast<float>(_accumulator / _stepSize);
+        _totalSteps += static_cast<uint64_t>(steps);
+        _lastStepCount = steps;
+        return steps;
+    }
+
+    void SetRate(float rate) { _stepSize = 1.0 / std::clamp(static_cast<double>(rate), 1.0, 1000.0); }
+    void SetMaxStepsPerFrame(int steps) { _maxStepsPerFrame = std::max(1, steps); }
+
+    float GetRate() const { return static_cast<float>(1.0 / _stepSize); }
+    float GetStepSize() const { return static_cast<float>(_stepSize); }
+    int GetMaxStepsPerFrame() const { return _maxStepsPerFrame; }
+    float GetAlpha() const { return _alpha; }
+    int GetLastStepCount() const { return _lastStepCount; }
+    uint64_t GetTotalSteps() const { return _totalSteps; }
+    uint64_t GetDroppedSteps() const { return _droppedSteps; }
+
+    void Reset() {
+        _accumulator = 0.0;
+        _alpha = 0.0f;
+        _totalSteps = 0;
+        _droppedSteps = 0;
+        _lastStepCount = 0;
+    }
+};
+
+// Paces a loop to a deadline. Sleeps in 1 ms slices while the scheduler can
+// be trusted to wake us in time and spins the remainder. How long a slice
+// really takes is measured as we go, so the spin stays short on systems with
+// a fine timer and grows on coarse ones.
+class FrameLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    Clock::time_point _nextFrame = Clock::now();
+
+    // Running mean and variance of a 1 ms sleep, in seconds
+    double _sleepMean = 0.002;
+    double _sleepM2 = 0.0;
+    uint64_t _sleepSamples = 1;
+
+    double GetSleepEstimate() const {
+        double stddev = _sleepSamples > 1 ? std::sqrt(_sleepM2 / (_sleepSamples - 1)) : 0.0;
+        return _sleepMean + stddev;
+    }
+
+    void AddSleepSample(double seconds) {
+        // Bounded window so the estimate follows changes in timer resolution
+        if (_sleepSamples >= 256) {
+            _sleepSamples = 128;
+            _sleepM2 *= 0.5;
+        }
+
+        ++_sleepSamples;
+        double delta = seconds - _sleepMean;
+        _sleepMean += delta / static_cast<double>(_sleepSamples);
+        _sleepM2 += delta * (seconds - _sleepMean);
+    }
+
+public:
+    // Schedules the next frame one interval after the previous deadline. A
+    // loop that fell more than a frame behind starts over from now instead of
+    // rendering a burst to catch up.
+    void MarkFrame(double interval) {
+        Clock::time_point now = Clock::now();
+        if (interval <= 0.0) {
+            _nextFrame = now;
+            return;
+        }
+
+        auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval));
+        _nextFrame += step;
+        if (_nextFrame + step < now) {
+            _nextFrame = now + step;
+        }
+        else if (_nextFrame < now) {
+            _nextFrame = now;
+        }
+    }
+
+    bool IsFrameDue(Clock::time_point now = Clock::now()) const { return now >= _nextFrame; }
+    Clock::time_point GetNextFrameTime() const { return _nextFrame; }
+    void Reset() { _nextFrame = Clock::now(); }
+
+    // Returns early once keepWaiting turns false, checked between slices
+    void WaitUntil(Clock::time_point deadline, const std::atomic<bool>* keepWaiting = nullptr) {
+        while (true) {
+            if (keepWaiting && !keepWaiting->load(std::memory_order_relaxed)) return;
+
+            double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+            if (remaining <= GetSleepEstimate()) break;
+
+            Clock::time_point start = Clock::now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            AddSleepSample(std::chrono::duration<double>(Clock::now() - start).count());
+        }
+
+        while (Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    void WaitForNextFrame(const std::atomic<bool>* keepWaiting = nullptr) {
+        WaitUntil(_nextFrame, keepWaiting);
+    }
+
+    double GetSleepOvershoot() const { return GetSleepEstimate() - 0.001; }
+};
+
 struct Timer {
     std::chrono::time_point<std::chrono::steady_clock> m_startTime;
     std::string m_name;
@@ -0,0 +1,109 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "test_framework.h"
+#include "../src/BackEnd/backend.h"
+#include "../src/BackEnd/Null/Null_backEnd.h"
+#include "../src/BackEnd/OpenGL/GL_state_cache.h"
+#include "../src/core/telemetry.h"
+
+namespace {
+    // Fresh counters and state for every test, the backend is process wide
+    NullBackend& GetNullBackend() {
+        NullBackend* backend = static_cast<NullBackend*>(GraphicsBackend::Get());
+        backend->ResetStats();
+        GLStateCache::GetCurrent().Invalidate();
+        GLStateCache::GetCurrent().TakeFrameCounters();
+        return *backend;
+    }
+}
+
+P32_TEST(NullBackend_IsActiveAndHeadless) {
+    CHECK(GraphicsBackend::Get() != nullptr);
+    CHECK(GraphicsBackend::GetCurrentType() == BackendType::Null);
+    CHECK(GraphicsBackend::IsHeadless());
+    CHECK(GraphicsBackend::Get()->GetType() == BackendType::Null);
+}
+
+P32_TEST(NullBackend_CountsDrawsAndTriangles) {
+    NullBackend& backend = GetNullBackend();
+
+    backend.BeginFrame();
+    backend.DrawIndexed(1, 36);
+    backend.DrawArrays(1, 6);
+    backend.DrawIndexedInstanced(2, 36, 10, 0);
+    backend.MultiDrawIndexedIndirect(3, 4, 0, 5, 500);
+    backend.EndFrame();
+
+    NullBackendStats stats = backend.GetStats();
+    CHECK_EQ(stats.frames, 1u);
+    CHECK_EQ(stats.drawCalls, 4u);
+    CHECK_EQ(stats.triangles, 12u + 2u + 120u + 500u);
+}
+
+P32_TEST(NullBackend_SkipsRedundantState) {
+    NullBackend& backend = GetNullBackend();
+
+    backend.BindShader(7);
+    backend.BindShader(7);
+    backend.BindShader(8);
+    backend.SetBlending(true);
+    backend.SetBlending(true);
+
+    NullBackendStats stats = backend.GetStats();
+    CHECK_EQ(stats.shaderBinds, 2u);
+    // Blending on is an enable plus a blend func, the repeat skips both
+    CHECK_EQ(stats.stateChanges, 2u + 2u);
+    CHECK_EQ(stats.skippedStateChanges, 1u + 2u);
+}
+
+P32_TEST(NullBackend_CountsUploads) {
+    NullBackend& backend = GetNullBackend();
+
+    unsigned int first = backend.CreateBuffer();
+    unsigned int second = backend.CreateBuffer();
+    CHECK(first != 0);
+    CHECK(first != second);
+
+    std::array<uint8_t, 256> data{};
+    backend.UploadBufferData(first, data.data(), data.size());
+    backend.UpdateBufferSubData(second, data.data(), 64, 0);
+    backend.SetUniformMat4(0, glm::mat4(1.0f));
+    backend.SetShaderFloat(1, "value", 1.0f);
+
+    NullBackendStats stats = backend.GetStats();
+    CHECK_EQ(stats.bufferUploads, 2u);
+    CHECK_EQ(stats.bytesUploaded, 256u + 64u);
+    CHECK_EQ(stats.uniformUploads, 2u);
+}
+
+P32_TEST(NullBackend_FeedsFrameTelemetry) {
+    NullBackend& backend = GetNullBackend();
+    FrameTelemetry telemetry;
+
+    {
+        FrameTelemetry::Scope scope(&telemetry);
+        backend.BeginFrame();
+        backend.DrawIndexedInstanced(1, 36, 2, 0);
+        backend.BindShader(3);
+        backend.BindShader(3);
+        backend.EndFrame();
+    }
+    telemetry.EndFrame(1, 16.0f, 2.0f);
+
+    FrameStats stats;
+    CHECK(telemetry.GetLatest(stats));
+    CHECK_EQ(stats.frameIndex, 1u);
+    CHECK_EQ(stats.drawCalls, 1u);
+    CHECK_EQ(stats.triangles, 24u);
+    CHECK(stats.stateCallsIssued > 0);
+    CHECK_EQ(stats.stateCallsSkipped, 1u);
+}
@@ -0,0 +1,101 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "test_framework.h"
+#include "../src/renderer/occlusion.h"
+#include "../src/core/job_system.h"
+
+namespace {
+    constexpr float NEAR_PLANE = 0.1f;
+
+    // Camera at the origin looking down -Z
+    glm::mat4 GetViewProjection() {
+        glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, NEAR_PLANE, 100.0f);
+        glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return projection * view;
+    }
+
+    // 4 x 4 wall five units in front of the camera
+    glm::mat4 GetWallModel() {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f));
+        return glm::scale(model, glm::vec3(4.0f, 4.0f, 0.5f));
+    }
+}
+
+P32_TEST(Occlusion_NothingOccludedWithoutOccluders) {
+    OcclusionCuller culler;
+    culler.Begin(GetViewProjection(), NEAR_PLANE);
+    culler.Rasterize();
+
+    CHECK(!culler.IsOccluded(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f));
+    CHECK_EQ(culler.GetStats().occluders, 0u);
+}
+
+P32_TEST(Occlusion_WallHidesWhatIsBehindIt) {
+    OcclusionCuller culler;
+    culler.Begin(GetViewProjection(), NEAR_PLANE);
+    culler.AddBoxOccluder(GetWallModel());
+    culler.Rasterize();
+
+    CHECK_EQ(culler.GetStats().occluders, 1u);
+    CHECK(culler.GetStats().triangles > 0);
+
+    // Behind the wall
+    CHECK(culler.IsOccluded(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f));
+    CHECK(culler.IsOccluded(glm::vec3(2.0f, -2.0f, -30.0f), 1.0f));
+
+    // In front of the wall, beside it, and poking out past its edge
+    CHECK(!culler.IsOccluded(glm::vec3(0.0f, 0.0f, -2.0f), 0.5f));
+    CHECK(!culler.IsOccluded(glm::vec3(15.0f, 0.0f, -20.0f), 1.0f));
+    CHECK(!culler.IsOccluded(glm::vec3(0.0f, 0.0f, -20.0f), 12.0f));
+
+    // Crossing the near plane is never culled
+    CHECK(!culler.IsOccluded(glm::vec3(0.0f, 0.0f, -0.05f), 0.2f));
+}
+
+P32_TEST(Occlusion_OccluderBehindCameraHidesNothing) {
+    OcclusionCuller culler;
+    culler.Begin(GetViewProjection(), NEAR_PLANE);
+    culler.AddBoxOccluder(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 5.0f)), glm::vec3(4.0f)));
+    culler.Rasterize();
+
+    CHECK(!culler.IsOccluded(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f));
+}
+
+P32_TEST(Occlusion_CullKeepsOrderAndMatchesOnThePool) {
+    const std::vector<glm::vec4> spheres = {
+        { 0.0f, 0.0f, -20.0f, 1.0f },   // hidden
+        { 15.0f, 0.0f, -20.0f, 1.0f },  // visible
+        { 1.0f, 1.0f, -40.0f, 1.0f },   // hidden
+        { 0.0f, 0.0f, -2.0f, 0.5f },    // visible
+    };
+
+    CullingBounds bounds;
+    bounds.Resize(spheres.size());
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        bounds.Set(i, glm::vec3(spheres[i]), spheres[i].w);
+    }
+
+    ThreadPool pool(2);
+    for (ThreadPool* usedPool : { static_cast<ThreadPool*>(nullptr), &pool }) {
+        OcclusionCuller culler;
+        culler.Begin(GetViewProjection(), NEAR_PLANE);
+        culler.AddBoxOccluder(GetWallModel());
+        culler.Rasterize(usedPool);
+
+        std::vector<uint32_t> visible = { 0, 1, 2, 3 };
+        culler.Cull(bounds, visible, usedPool);
+
+        CHECK(visible == std::vector<uint32_t>({ 1, 3 }));
+        CHECK_EQ(culler.GetStats().tested, 4u);
+        CHECK_EQ(culler.GetStats().occluded, 2u);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "test_framework.h"
+#include "../src/renderer/render_graph.h"
+
+namespace {
+    const RenderTextureDesc TARGET_DESC{ 256, 256 };
+
+    size_t GetPosition(const RenderGraph& graph, size_t pass) {
+        const std::vector<uint32_t>& order = graph.GetExecutionOrder();
+        return std::find(order.begin(), order.end(), static_cast<uint32_t>(pass)) - order.begin();
+    }
+}
+
+P32_TEST(RenderGraph_CullsUnusedPasses) {
+    RenderGraph graph;
+    RenderResource color = graph.CreateTexture("Color", TARGET_DESC);
+    RenderResource unused = graph.CreateTexture("Unused", TARGET_DESC);
+    RenderResource backbuffer = graph.ImportBackbuffer(256, 256);
+
+    graph.AddPass("Scene", nullptr).Writes(color, LoadOp::Clear);
+    graph.AddPass("Orphan", nullptr).Writes(unused, LoadOp::Clear);
+    graph.AddPass("Debug", nullptr).SideEffect();
+    graph.AddPass("Present", nullptr).Reads(color).Writes(backbuffer);
+
+    CHECK(graph.Compile());
+    CHECK(!graph.IsPassCulled(0));
+    CHECK(graph.IsPassCulled(1));
+    CHECK(!graph.IsPassCulled(2));
+    CHECK(!graph.IsPassCulled(3));
+    CHECK_EQ(graph.GetStats().culledPasses, 1u);
+    CHECK_EQ(graph.GetExecutionOrder().size(), size_t(3));
+}
+
+P32_TEST(RenderGraph_ReaderSeesEarlierWriter) {
+    RenderGraph graph;
+    RenderResource color = graph.CreateTexture("Color", TARGET_DESC);
+    RenderResource backbuffer = graph.ImportBackbuffer(256, 256);
+
+    // The second write comes after the only read, nothing sees it
+    graph.AddPass("Scene", nullptr).Writes(color, LoadOp::Clear);
+    graph.AddPass("Present", nullptr).Reads(color).Writes(backbuffer);
+    graph.AddPass("Overwrite", nullptr).Writes(color, LoadOp::Clear);
+
+    CHECK(graph.Compile());
+    CHECK(!graph.IsPassCulled(0));
+    CHECK(!graph.IsPassCulled(1));
+    CHECK(graph.IsPassCulled(2));
+    CHECK(GetPosition(graph, 0) < GetPosition(graph, 1));
+}
+
+P32_TEST(RenderGraph_PingPongHasNoCycle) {
+    RenderGraph graph;
+    RenderResource a = graph.CreateTexture("A", TARGET_DESC);
+    RenderResource b = graph.CreateTexture("B", TARGET_DESC);
+    RenderResource backbuffer = graph.ImportBackbuffer(256, 256);
+
+    graph.AddPass("Fill", nullptr).Writes(a, LoadOp::Clear);
+    graph.AddPass("BlurX", nullptr).Reads(a).Writes(b, LoadOp::DontCare);
+    graph.AddPass("BlurY", nullptr).Reads(b).Writes(a, LoadOp::DontCare);
+    graph.AddPass("Present", nullptr).Reads(a).Writes(backbuffer);
+
+    CHECK(graph.Compile());
+    CHECK_EQ(graph.GetStats().culledPasses, 0u);
+
+    // BlurY overwrites A only after BlurX has read it
+    for (size_t pass = 1; pass < graph.GetPassCount(); ++pass) {
+        CHECK(GetPosition(graph, pass - 1) < GetPosition(graph, pass));
+    }
+}
+
+P32_TEST(RenderGraph_DisjointTransientsShareTextures) {
+    RenderGraph graph;
+    RenderResource first = graph.CreateTexture("First", TARGET_DESC);
+    RenderResource second = graph.CreateTexture("Second", TARGET_DESC);
+    RenderResource third = graph.CreateTexture("Third", TARGET_DESC);
+    RenderResource backbuffer = graph.ImportBackbuffer(256, 256);
+
+    std::vector<std::string> ran;
+    auto record = [&ran](const char* name) {
+        return [&ran, name](RenderPassContext&) { ran.emplace_back(name); };
+    };
+
+    // First is released before Third is acquired
+    graph.AddPass("A", record("A")).Writes(first, LoadOp::Clear);
+    graph.AddPass("B", record("B")).Reads(first).Writes(second, LoadOp::Clear);
+    graph.AddPass("C", record("C")).Reads(second).Writes(third, LoadOp::Clear);
+    graph.AddPass("D", record("D")).Reads(third).Writes(backbuffer);
+
+    RenderTargetPool pool;
+    CHECK(graph.Compile());
+    graph.Execute(pool);
+
+    const RenderGraphStats& stats = graph.GetStats();
+    CHECK_EQ(stats.transientTextures, 3u);
+    CHECK_EQ(stats.physicalTextures, 2u);
+    CHECK_EQ(stats.physicalBytes, 2 * TARGET_DESC.GetSizeBytes());
+    CHECK_EQ(pool.GetTextureCount(), size_t(2));
+    CHECK_EQ(ran.size(), size_t(4));
+    CHECK(ran == std::vector<std::string>({ "A", "B", "C", "D" }));
+}
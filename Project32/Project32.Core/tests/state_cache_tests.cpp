@@ -0,0 +1,114 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "test_framework.h"
+#include "../src/BackEnd/OpenGL/GL_state_cache.h"
+
+// Counting-only caches, nothing here reaches GL
+
+P32_TEST(StateCache_SkipsRepeatedState) {
+    GLStateCache cache(false);
+
+    CHECK(cache.UseProgram(3));
+    CHECK(!cache.UseProgram(3));
+    CHECK(cache.UseProgram(4));
+
+    CHECK(cache.SetEnabled(GL_DEPTH_TEST, true));
+    CHECK(!cache.SetEnabled(GL_DEPTH_TEST, true));
+    CHECK(cache.SetEnabled(GL_DEPTH_TEST, false));
+
+    CHECK(cache.DepthFunc(GL_LESS));
+    CHECK(!cache.DepthFunc(GL_LESS));
+    CHECK(cache.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    CHECK(!cache.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    CHECK(cache.Viewport(0, 0, 640, 480));
+    CHECK(!cache.Viewport(0, 0, 640, 480));
+    CHECK(cache.Viewport(0, 0, 800, 600));
+
+    CHECK_EQ(cache.GetTotals().issued, 8u);
+    CHECK_EQ(cache.GetTotals().skipped, 5u);
+}
+
+P32_TEST(StateCache_FrameCountersReset) {
+    GLStateCache cache(false);
+
+    cache.BindVertexArray(1);
+    cache.BindVertexArray(1);
+
+    GLStateCounters frame = cache.TakeFrameCounters();
+    CHECK_EQ(frame.issued, 1u);
+    CHECK_EQ(frame.skipped, 1u);
+
+    cache.BindVertexArray(1);
+    frame = cache.TakeFrameCounters();
+    CHECK_EQ(frame.issued, 0u);
+    CHECK_EQ(frame.skipped, 1u);
+
+    CHECK_EQ(cache.GetTotals().issued, 1u);
+    CHECK_EQ(cache.GetTotals().skipped, 2u);
+}
+
+P32_TEST(StateCache_TextureUnitsTrackedSeparately) {
+    GLStateCache cache(false);
+
+    // First bind also selects the unit
+    CHECK(cache.BindTexture(0, GL_TEXTURE_2D, 5));
+    CHECK(cache.BindTexture(1, GL_TEXTURE_2D, 6));
+    CHECK(!cache.BindTexture(0, GL_TEXTURE_2D, 5));
+    CHECK(!cache.BindTexture(1, GL_TEXTURE_2D, 6));
+    CHECK(cache.BindTexture(1, GL_TEXTURE_2D_ARRAY, 6));
+    CHECK_EQ(cache.GetTotals().issued, 2u + 2u + 1u);
+
+    // Rebinding on the active unit keeps the unit
+    cache.TakeFrameCounters();
+    CHECK(cache.BindTexture(1, GL_TEXTURE_2D, 7));
+    GLStateCounters frame = cache.TakeFrameCounters();
+    CHECK_EQ(frame.issued, 1u);
+    CHECK_EQ(frame.skipped, 1u);
+}
+
+P32_TEST(StateCache_BindingAliases) {
+    GLStateCache cache(false);
+
+    // GL_FRAMEBUFFER sets both the draw and the read binding
+    CHECK(cache.BindFramebuffer(GL_FRAMEBUFFER, 4));
+    CHECK(!cache.BindFramebuffer(GL_READ_FRAMEBUFFER, 4));
+    CHECK(!cache.BindFramebuffer(GL_DRAW_FRAMEBUFFER, 4));
+    CHECK(cache.BindFramebuffer(GL_READ_FRAMEBUFFER, 0));
+
+    // An indexed uniform bind also replaces the generic one
+    CHECK(cache.BindBufferBase(GL_UNIFORM_BUFFER, 0, 9));
+    CHECK(!cache.BindBufferBase(GL_UNIFORM_BUFFER, 0, 9));
+    CHECK(!cache.BindBuffer(GL_UNIFORM_BUFFER, 9));
+
+    // Element array bindings live in the VAO and always go through
+    CHECK(cache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 3));
+    CHECK(cache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 3));
+}
+
+P32_TEST(StateCache_DeletedObjectsAreForgotten) {
+    GLStateCache cache(false);
+
+    cache.UseProgram(3);
+    cache.BindBuffer(GL_ARRAY_BUFFER, 8);
+    cache.DepthFunc(GL_LEQUAL);
+
+    // Names may be reused after a delete, fixed function state is unaffected
+    GLStateCache::OnObjectsDeleted();
+    CHECK(cache.UseProgram(3));
+    CHECK(cache.BindBuffer(GL_ARRAY_BUFFER, 8));
+    CHECK(!cache.DepthFunc(GL_LEQUAL));
+
+    // Invalidate forgets everything
+    cache.Invalidate();
+    CHECK(cache.UseProgram(3));
+    CHECK(cache.DepthFunc(GL_LEQUAL));
+}
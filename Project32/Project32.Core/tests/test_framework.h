@@ -0,0 +1,58 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#pragma once
+
+#ifndef TEST_FRAMEWORK_H
+#define TEST_FRAMEWORK_H
+
+#include "../src/common.h"
+
+// Just enough of a test runner for the headless checks. Tests register
+// themselves at static init, a failed CHECK reports and keeps going so one
+// run lists every broken expectation.
+namespace Tests {
+    using TestFn = void(*)();
+
+    struct TestCase {
+        const char* name;
+        TestFn fn;
+    };
+
+    std::vector<TestCase>& GetRegistry();
+    void ReportFailure(const char* file, int line, const std::string& message);
+
+    struct Registrar {
+        Registrar(const char* name, TestFn fn) { GetRegistry().push_back({ name, fn }); }
+    };
+}
+
+#define P32_TEST(name) \
+    static void name(); \
+    static Tests::Registrar name##_registrar(#name, &name); \
+    static void name()
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) Tests::ReportFailure(__FILE__, __LINE__, #condition); \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) \
+    do { \
+        const auto& checkActual = (actual); \
+        const auto& checkExpected = (expected); \
+        if (!(checkActual == checkExpected)) { \
+            Tests::ReportFailure(__FILE__, __LINE__, std::format("{} == {} (got {}, expected {})", \
+                #actual, #expected, checkActual, checkExpected)); \
+        } \
+    } while (0)
+
+#endif // TEST_FRAMEWORK_H
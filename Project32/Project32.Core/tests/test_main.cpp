@@ -0,0 +1,59 @@
+/*
+ * This file is part of Project32 - A compact yet powerful and flexible C++ Game Engine
+ * Copyright (c) 2025 Patrick Reese (Retroboi64)
+ *
+ * Licensed under MIT with Attribution Requirements
+ * See LICENSE file for full terms
+ * GitHub: https://github.com/Retroboi64/Project32
+ *
+ * This header must not be removed from any source file.
+ */
+
+#include "test_framework.h"
+#include "../src/BackEnd/backend.h"
+
+namespace {
+    size_t s_failures = 0;
+}
+
+std::vector<Tests::TestCase>& Tests::GetRegistry() {
+    static std::vector<TestCase> registry;
+    return registry;
+}
+
+void Tests::ReportFailure(const char* file, int line, const std::string& message) {
+    ++s_failures;
+    std::cerr << file << "(" << line << "): CHECK failed: " << message << std::endl;
+}
+
+int main(int argc, char** argv) {
+    spdlog::set_level(spdlog::level::warn);
+
+    // Everything runs on the null backend, no window or GL context needed
+    if (!GraphicsBackend::Initialize(BackendType::Null)) {
+        std::cerr << "Failed to initialize the null backend" << std::endl;
+        return 1;
+    }
+
+    // Optional argument picks the tests whose name contains it
+    std::string_view filter = argc > 1 ? argv[1] : "";
+
+    size_t run = 0;
+    size_t failedTests = 0;
+    for (const Tests::TestCase& test : Tests::GetRegistry()) {
+        if (!filter.empty() && std::string_view(test.name).find(filter) == std::string_view::npos) continue;
+
+        size_t failuresBefore = s_failures;
+        test.fn();
+        ++run;
+
+        bool passed = s_failures == failuresBefore;
+        if (!passed) ++failedTests;
+        std::cout << (passed ? "[ PASS ] " : "[ FAIL ] ") << test.name << std::endl;
+    }
+
+    GraphicsBackend::Destroy();
+
+    std::cout << run - failedTests << " / " << run << " tests passed" << std::endl;
+    return failedTests == 0 ? 0 : 1;
+}